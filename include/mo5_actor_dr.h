@@ -49,6 +49,7 @@
 typedef struct {
     const MO5_Sprite *sprite;
     MO5_Position      pos;
+    unsigned char     flip;     // MO5_FLIP_* applied by save_draw (0 after init)
     unsigned char     save_color[MO5_DR_SAVE_SIZE];
     unsigned char     save_form[MO5_DR_SAVE_SIZE];
 } MO5_Actor_DR;
@@ -85,4 +86,10 @@ void mo5_actor_dr_save_draw(MO5_Actor_DR *actor);
  */
 void mo5_actor_dr_move(MO5_Actor_DR *actor, unsigned char x, unsigned char y);
 
+/**
+ * Sets the mirroring (MO5_FLIP_H | MO5_FLIP_V) used from the next
+ * mo5_actor_dr_save_draw() call. Save/restore are not affected.
+ */
+void mo5_actor_dr_set_flip(MO5_Actor_DR *actor, unsigned char flip);
+
 #endif // MO5_ACTOR_DR_H
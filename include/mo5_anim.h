@@ -0,0 +1,125 @@
+/**
+ * @file
+ * @brief Sprite animation — frame lists with per-frame durations,
+ *        loop / ping-pong / one-shot playback over a sprite sheet.
+ *
+ * An animation (MO5_AnimDef, static) is a list of sheet frame indices
+ * with a duration in ticks (VBL frames) for each. A player (MO5_Anim)
+ * owns the MO5_Sprite the actor points to, advances with the number of
+ * elapsed ticks, and only reports a change when the displayed sheet
+ * frame actually differs.
+ *
+ * mo5_anim_actor_move() replaces the engine move call: an actor whose
+ * frame and position are both unchanged is not redrawn at all.
+ *
+ * Typical per-frame sequence:
+ *   mo5_wait_vbl();
+ *   mo5_anim_update(&hero_anim, 1);
+ *   mo5_anim_actor_move(&hero, &hero_anim, x, y, &form_engine);
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_ANIM_H
+#define MO5_ANIM_H
+
+#include "mo5_sheet.h"
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+#define MO5_ANIM_LOOP      0   // 0 1 2 0 1 2 ...
+#define MO5_ANIM_PINGPONG  1   // 0 1 2 1 0 1 ...
+#define MO5_ANIM_ONCE      2   // 0 1 2, then stays on the last frame
+
+// ============================================================================
+// STRUCTURES
+// ============================================================================
+
+/** Animation (static resource). */
+typedef struct {
+    const unsigned char *frames;     // Sheet frame indices
+    const unsigned char *durations;  // Ticks per frame (>= 1), one per entry
+    unsigned char        count;      // Number of entries (>= 1)
+    unsigned char        mode;       // MO5_ANIM_LOOP / PINGPONG / ONCE
+} MO5_AnimDef;
+
+/**
+ * Animation player.
+ * The actor must point to anim.sprite (actor.sprite = &anim.sprite).
+ * Must be initialized with mo5_anim_init() before any use.
+ */
+typedef struct {
+    const MO5_SpriteSheet *sheet;
+    const MO5_AnimDef     *def;
+    MO5_Sprite             sprite;   // Displayed frame
+    unsigned char          shown;    // Sheet index of the displayed frame
+    unsigned char          step;     // Current entry in def->frames
+    unsigned char          timer;    // Ticks left on the current entry
+    signed char            dir;      // Ping-pong direction (+1 / -1)
+    unsigned char          done;     // One-shot animation finished
+    unsigned char          pending;  // Frame changed, not displayed yet
+} MO5_Anim;
+
+/**
+ * Draw/clear/move functions of a sprite engine, used by
+ * mo5_anim_actor_move(). Declare one per engine with the macros below:
+ *   static const MO5_AnimEngine form_engine = MO5_ANIM_ENGINE_FORM;
+ */
+typedef struct {
+    void (*draw)(const MO5_Actor *actor);
+    void (*clear)(const MO5_Actor *actor);
+    void (*move)(MO5_Actor *actor, unsigned char new_x, unsigned char new_y);
+} MO5_AnimEngine;
+
+#define MO5_ANIM_ENGINE_OPAQUE  { mo5_actor_draw,      mo5_actor_clear,      mo5_actor_move      }
+#define MO5_ANIM_ENGINE_BG      { mo5_actor_draw_bg,   mo5_actor_clear_bg,   mo5_actor_move_bg   }
+#define MO5_ANIM_ENGINE_FORM    { mo5_actor_draw_form, mo5_actor_clear_form, mo5_actor_move_form }
+
+/** 1 once a MO5_ANIM_ONCE animation has reached its last frame. */
+#define MO5_ANIM_DONE(anim)  ((anim)->done)
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Initializes the player on @p sheet and starts @p def.
+ * anim->sprite holds the first frame on return (nothing is drawn).
+ */
+void mo5_anim_init(MO5_Anim *anim, const MO5_SpriteSheet *sheet, const MO5_AnimDef *def);
+
+/**
+ * Switches to @p def from its first entry.
+ * No-op if @p def is already playing, so it can be called every frame
+ * (e.g. "walk while the stick is held").
+ */
+void mo5_anim_play(MO5_Anim *anim, const MO5_AnimDef *def);
+
+/**
+ * Advances by @p elapsed ticks (usually 1 per mo5_wait_vbl).
+ *
+ * @return 1 if the displayed frame must change, 0 otherwise.
+ */
+unsigned char mo5_anim_update(MO5_Anim *anim, unsigned char elapsed);
+
+/**
+ * Loads the pending frame into anim->sprite, without drawing.
+ * For engines that redraw every frame anyway (mo5_actor_dr).
+ *
+ * @return 1 if anim->sprite changed, 0 otherwise.
+ */
+unsigned char mo5_anim_apply(MO5_Anim *anim);
+
+/**
+ * Moves the actor to (new_x, new_y) and displays the current frame.
+ * Frame unchanged: the engine move is called (itself a no-op if the
+ * position is unchanged). Frame changed: clear, load frame, draw.
+ */
+void mo5_anim_actor_move(MO5_Actor *actor, MO5_Anim *anim,
+                         unsigned char new_x, unsigned char new_y,
+                         const MO5_AnimEngine *engine);
+
+#endif // MO5_ANIM_H
@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @brief Linear (bump-pointer) arena allocator with mark/release.
+ *
+ * Replaces malloc for data whose lifetime follows the game structure:
+ *   - level arena : tilemaps, decompressed sprites (reset at level change)
+ *   - frame arena : temporary buffers (reset at the start of each frame)
+ *
+ * Allocation is a pointer bump — no header, no alignment padding,
+ * no fragmentation. Memory is only given back in bulk, with
+ * mo5_arena_release() (back to a mark) or mo5_arena_reset().
+ *
+ * Typical usage:
+ *   static unsigned char level_mem[4096];
+ *   static MO5_Arena     level;
+ *
+ *   mo5_arena_init(&level, level_mem, sizeof(level_mem));
+ *   map = mo5_arena_alloc(&level, 40 * 25);
+ *   ...
+ *   mo5_arena_reset(&level);        // next level
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_ARENA_H
+#define MO5_ARENA_H
+
+#include <cmoc.h>
+
+// ============================================================================
+// STRUCTURE
+// ============================================================================
+
+/**
+ * Arena descriptor.
+ *
+ * [base, top) is allocated, [top, end) is free.
+ * high keeps the highest top reached since init (high-water mark),
+ * to size the buffer from real usage.
+ *
+ * Must be initialized with mo5_arena_init() before any use.
+ */
+typedef struct {
+    unsigned char *base;   // Start of the caller-provided buffer
+    unsigned char *top;    // Next free byte
+    unsigned char *end;    // One past the last byte
+    unsigned char *high;   // High-water mark
+} MO5_Arena;
+
+/** Saved allocation point — see mo5_arena_mark() / mo5_arena_release(). */
+typedef unsigned char *MO5_ArenaMark;
+
+// ============================================================================
+// INLINE HELPERS
+// ============================================================================
+
+/** Current allocation point, to be passed later to mo5_arena_release(). */
+#define mo5_arena_mark(arena)        ((arena)->top)
+
+/** Bytes currently allocated. */
+#define mo5_arena_used(arena)        ((unsigned int)((arena)->top  - (arena)->base))
+
+/** Bytes still available. */
+#define mo5_arena_remaining(arena)   ((unsigned int)((arena)->end  - (arena)->top))
+
+/** Peak number of bytes allocated since mo5_arena_init(). */
+#define mo5_arena_high_water(arena)  ((unsigned int)((arena)->high - (arena)->base))
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Initializes the arena over a caller-provided buffer (static array).
+ *
+ * @param arena  Arena descriptor.
+ * @param buf    Backing memory.
+ * @param size   Size of @p buf in bytes.
+ */
+void mo5_arena_init(MO5_Arena *arena, void *buf, unsigned int size);
+
+/**
+ * Allocates @p size bytes (no alignment, no header).
+ * The content is NOT cleared.
+ *
+ * @return Pointer to the block, or NULL if the arena is exhausted.
+ */
+void *mo5_arena_alloc(MO5_Arena *arena, unsigned int size);
+
+/**
+ * Frees every allocation made after @p mark was taken.
+ * Marks must be released in reverse order (stack discipline).
+ */
+void mo5_arena_release(MO5_Arena *arena, MO5_ArenaMark mark);
+
+/** Frees everything. The high-water mark is kept. */
+void mo5_arena_reset(MO5_Arena *arena);
+
+#endif // MO5_ARENA_H
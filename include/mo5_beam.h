@@ -0,0 +1,108 @@
+/**
+ * @file
+ * @brief Race-the-beam draw scheduler — tear-free sprite updates without double buffering.
+ *
+ * Draw requests are queued during the frame, sorted by screen row,
+ * and executed by mo5_beam_flush() right after mo5_wait_vbl():
+ *
+ *   1. Ahead of the beam : requests are drawn top to bottom while the
+ *      beam is still in the blanking area or above their first row.
+ *   2. Behind the beam   : requests that would be caught by the beam are
+ *      deferred, sorted by last row, and drawn once the beam has passed
+ *      below them.
+ *
+ * The beam position is not readable on the MO5: it is predicted from
+ * the time elapsed since the VBL (blanking length measured by
+ * mo5_beam_init) and from a cost estimate given with each request.
+ *
+ * Typical usage:
+ *   mo5_beam_add_actor((MO5_BeamDraw)mo5_actor_draw_bg, &player, MO5_BEAM_CPB_BG);
+ *   mo5_beam_add_actor((MO5_BeamDraw)mo5_actor_draw_bg, &enemy,  MO5_BEAM_CPB_BG);
+ *   mo5_wait_vbl();
+ *   mo5_beam_flush();
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_BEAM_H
+#define MO5_BEAM_H
+
+#include "mo5_frame.h"
+#include "mo5_sprite_types.h"
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+#define MO5_BEAM_MAX          16    // Queued requests per frame
+#define MO5_BEAM_LINE_SHIFT   6     // 64 cycles per scanline
+
+/*
+ * Estimated cycles per sprite byte, per engine (conservative).
+ * Refine with mo5_prof.h for the actual game build.
+ */
+#define MO5_BEAM_CPB_FORM     30    // mo5_sprite_form : form bank only
+#define MO5_BEAM_CPB_OPAQUE   60    // mo5_sprite      : 2 banks
+#define MO5_BEAM_CPB_BG       80    // mo5_sprite_bg   : read-modify-write, 2 banks
+#define MO5_BEAM_CPB_DR       200   // mo5_actor_dr    : save 2 banks + draw
+
+// ============================================================================
+// TYPES
+// ============================================================================
+
+/** Draw callback — e.g. mo5_actor_draw_bg, cast to MO5_BeamDraw. */
+typedef void (*MO5_BeamDraw)(void *obj);
+
+/** Queued draw request. */
+typedef struct {
+    MO5_BeamDraw  draw;     // Draw callback
+    void         *obj;      // Callback argument (actor)
+    unsigned char top;      // First pixel row touched
+    unsigned char bottom;   // Last pixel row touched + 1
+    unsigned int  cost;     // Estimated cycles
+} MO5_BeamCmd;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Measures the blanking length (waits 2 VBLs).
+ * Call once after mo5_video_init().
+ */
+void mo5_beam_init(void);
+
+/**
+ * Queues a draw request, kept sorted by @p y.
+ * If the queue is full, the request is drawn immediately.
+ *
+ * @param draw  Draw callback
+ * @param obj   Callback argument
+ * @param y     First pixel row touched
+ * @param h     Number of pixel rows touched
+ * @param cost  Estimated cycles (see MO5_BEAM_CPB_xxx)
+ */
+void mo5_beam_add(MO5_BeamDraw draw, void *obj,
+                  unsigned char y, unsigned char h, unsigned int cost);
+
+/**
+ * Queues an actor draw; rows and cost are taken from its sprite.
+ *
+ * @param draw  mo5_actor_draw / _draw_bg / _draw_form, cast to MO5_BeamDraw
+ * @param actor Actor to draw
+ * @param cpb   Cycles per sprite byte (MO5_BEAM_CPB_xxx)
+ */
+void mo5_beam_add_actor(MO5_BeamDraw draw, const MO5_Actor *actor,
+                        unsigned char cpb);
+
+/**
+ * Executes the queued requests in beam order and empties the queue.
+ * Must be called right after mo5_wait_vbl().
+ */
+void mo5_beam_flush(void);
+
+/** Drops the queued requests without drawing them. */
+void mo5_beam_clear(void);
+
+#endif // MO5_BEAM_H
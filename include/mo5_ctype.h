@@ -1,6 +1,14 @@
 /**
  * @file
- * @brief Character classification functions (islower, isupper, isprint, ispunct).
+ * @brief Character classification — 256-byte table and macro tests.
+ *
+ * Each test is one indexed load and one AND: no call, no range compare.
+ * The macros return a non-zero flag (not necessarily 1) for true; the
+ * function versions, kept for code that takes their address, return 0/1.
+ *
+ * islower/isupper/isprint/ispunct are not declared by cmoc.h. The tests
+ * cmoc.h does provide (isdigit, isspace, isalpha, isalnum) get mo5_
+ * prefixed macros here so both headers can be included together.
  *
  * SPDX-License-Identifier: MIT
  * Copyright (c) 2026 Thierry Le Got
@@ -9,16 +17,57 @@
 #ifndef CTYPE_H
 #define CTYPE_H
 
+// ============================================================================
+// CLASSIFICATION TABLE
+// ============================================================================
+
+#define MO5_CT_LOWER  0x01   // 'a'-'z'
+#define MO5_CT_UPPER  0x02   // 'A'-'Z'
+#define MO5_CT_DIGIT  0x04   // '0'-'9'
+#define MO5_CT_PUNCT  0x08   // printable, not alphanumeric, not space
+#define MO5_CT_SPACE  0x10   // ' ', '\t', '\n', '\v', '\f', '\r'
+#define MO5_CT_PRINT  0x20   // 32-126
+
+/** Class flags of every character code (128-255: none). */
+extern const unsigned char mo5_ctype_table[256];
+
+#define MO5_CTYPE(c, mask)  (mo5_ctype_table[(unsigned char)(c)] & (mask))
+
+// ============================================================================
+// TESTS (macros)
+// ============================================================================
+
+/** Non-zero if c is a lowercase letter ('a'-'z'). */
+#define islower(c)      MO5_CTYPE(c, MO5_CT_LOWER)
+
+/** Non-zero if c is an uppercase letter ('A'-'Z'). */
+#define isupper(c)      MO5_CTYPE(c, MO5_CT_UPPER)
+
+/** Non-zero if c is a printable character (32-126). */
+#define isprint(c)      MO5_CTYPE(c, MO5_CT_PRINT)
+
+/** Non-zero if c is a punctuation character. */
+#define ispunct(c)      MO5_CTYPE(c, MO5_CT_PUNCT)
+
+#define mo5_isdigit(c)  MO5_CTYPE(c, MO5_CT_DIGIT)
+#define mo5_isspace(c)  MO5_CTYPE(c, MO5_CT_SPACE)
+#define mo5_isalpha(c)  MO5_CTYPE(c, MO5_CT_LOWER | MO5_CT_UPPER)
+#define mo5_isalnum(c)  MO5_CTYPE(c, MO5_CT_LOWER | MO5_CT_UPPER | MO5_CT_DIGIT)
+
+// ============================================================================
+// FUNCTIONS (same tests, callable through a pointer)
+// ============================================================================
+
 /** @return 1 if c is a lowercase letter ('a'-'z'), 0 otherwise. */
-unsigned char islower(char c);
+unsigned char (islower)(char c);
 
 /** @return 1 if c is an uppercase letter ('A'-'Z'), 0 otherwise. */
-unsigned char isupper(char c);
+unsigned char (isupper)(char c);
 
 /** @return 1 if c is a printable character (32-126), 0 otherwise. */
-unsigned char isprint(char c);
+unsigned char (isprint)(char c);
 
 /** @return 1 if c is a punctuation character, 0 otherwise. */
-unsigned char ispunct(char c);
+unsigned char (ispunct)(char c);
 
 #endif // CTYPE_H
@@ -26,6 +26,13 @@ typedef enum {
 #define MO5_SPACE_CHAR          32
 #define MO5_LINE_FEED           10
 
+/* Touches fléchées (codes GETC du moniteur) */
+#define MO5_KEY_LEFT            8       // même code que MO5_BACKSPACE_CHAR
+#define MO5_KEY_RIGHT           9
+#define MO5_KEY_DOWN            10
+#define MO5_KEY_UP              11
+#define MO5_KEY_DEL             127
+
 /**
  * @brief Reads a single character from the input.
  * @return The character read.
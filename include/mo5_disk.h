@@ -0,0 +1,114 @@
+/**
+ * @file
+ * @brief On-demand file loading from floppy (overlays, level data).
+ *
+ * makefd.py --overlay writes files that are NOT loaded at boot, and
+ * describes them in an overlay table (track 0, sectors 2-8):
+ *
+ *   interleave       1 byte, table header
+ *   name[8] ext[3]   space-padded, uppercase
+ *   size             2 bytes, big-endian
+ *   run count        1 byte
+ *   runs             (track, first, last position) per run
+ *   ...
+ *   0xFF             end of table
+ *
+ * Positions 1-16 walk a track in interleave order: 1, 1+k, 1+2k... (mod
+ * 16, skipping sectors already taken). With k = 1, position = sector.
+ * makefd.py --interleave k lays each overlay on whole tracks, in
+ * ascending order, so the loader reads a full track per run and finds
+ * the next sector under the head instead of waiting a whole revolution.
+ *
+ * The loader reads the table and the file sectors through the monitor
+ * disk routine (SWI DKCO), like the boot loader. Each sector holds 255
+ * bytes of data (Thomson DOS layout).
+ *
+ *   python3 makefd.py game.fd game.BIN --overlay LEVEL1.DAT LEVEL2.DAT
+ *
+ *   if (mo5_disk_load("LEVEL2.DAT", level_buffer) != MO5_DISK_OK) ...
+ *
+ * Blocking calls: interrupts keep running, but the game loop is stopped
+ * while sectors are read.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_DISK_H
+#define MO5_DISK_H
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+/* Monitor disk registers (page $20) and entry point */
+#define DK_OPC   ((unsigned char *)0x2048)  // Operation (MO5_DK_READ)
+#define DK_DRV   ((unsigned char *)0x2049)  // Drive number
+#define DK_TRK   ((unsigned int *)0x204A)   // Track, 16 bits ($204A high byte must be 0)
+#define DK_SEC   ((unsigned char *)0x204C)  // Sector (1-16)
+#define DK_STA   ((unsigned char *)0x204E)  // Status of the last operation
+#define DK_BUF   ((unsigned char **)0x204F) // 256-byte transfer buffer
+
+#define MO5_DK_READ          0x02
+
+#define MO5_DISK_SECTOR_SIZE   256
+#define MO5_DISK_SECTOR_DATA   255   // Data bytes per sector (DOS layout)
+#define MO5_DISK_TABLE_TRACK   0
+#define MO5_DISK_TABLE_SECTOR  2     // Overlay table: sectors 2-8 of track 0
+#define MO5_DISK_TABLE_LAST    8
+#define MO5_DISK_MAX_RUNS      24    // OVERLAY_MAX_RUNS in makefd.py
+#define MO5_DISK_TRACK_SECTORS 16
+
+/* Return codes */
+#define MO5_DISK_OK            0
+#define MO5_DISK_NOT_FOUND     1
+#define MO5_DISK_IO_ERROR      2
+
+// ============================================================================
+// STRUCTURE
+// ============================================================================
+
+/** Overlay file location, filled by mo5_disk_find(). */
+typedef struct {
+    unsigned int  size;                           // Data bytes
+    unsigned char interleave;                     // From the table header
+    unsigned char run_count;
+    unsigned char runs[MO5_DISK_MAX_RUNS][3];     // track, first, last position
+} MO5_DiskFile;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/** Drive used by every call (default 0). */
+void mo5_disk_set_drive(unsigned char drive);
+
+/**
+ * Reads one 256-byte sector into @p buf through the monitor.
+ * @return MO5_DISK_OK or MO5_DISK_IO_ERROR.
+ */
+unsigned char mo5_disk_read_sector(unsigned char track, unsigned char sector,
+                                   unsigned char *buf);
+
+/**
+ * Looks up @p name ("LEVEL1.DAT", case-insensitive) in the overlay table.
+ * @return MO5_DISK_OK, MO5_DISK_NOT_FOUND or MO5_DISK_IO_ERROR (read
+ *         error, or a table with an invalid interleave or run count).
+ */
+unsigned char mo5_disk_find(const char *name, MO5_DiskFile *file);
+
+/**
+ * Loads a file found by mo5_disk_find() at @p dst (file->size bytes
+ * are written, no more). Each run is read in interleave order, straight
+ * into @p dst.
+ * @return MO5_DISK_OK or MO5_DISK_IO_ERROR.
+ */
+unsigned char mo5_disk_load_file(const MO5_DiskFile *file, unsigned char *dst);
+
+/**
+ * Finds and loads @p name at @p dst.
+ * @return MO5_DISK_OK, MO5_DISK_NOT_FOUND or MO5_DISK_IO_ERROR.
+ */
+unsigned char mo5_disk_load(const char *name, unsigned char *dst);
+
+#endif // MO5_DISK_H
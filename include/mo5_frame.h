@@ -0,0 +1,113 @@
+/**
+ * @file
+ * @brief Frame-time instrumentation — frame counter, VBL overruns, idle time, raster bar.
+ *
+ * mo5_wait_vbl() reports to this module on every call:
+ *   - frames     : number of frames waited
+ *   - idle_spins : polling iterations spent waiting (= unused frame time)
+ *   - overruns   : frames whose work did not fit in one VBL period
+ *
+ * Idle spins are converted to a load percentage once the empty-frame
+ * spin count has been measured (mo5_frame_calibrate).
+ *
+ * Overrun detection needs a time base independent from the polling:
+ * mo5_frame_init() starts the 50 Hz tick (mo5_tick.h) to count VBLs.
+ * Without it, overruns stay at 0. A frame is late when the tick count
+ * moved by 2 or more between two returns of mo5_wait_vbl(): this holds
+ * wherever the IRQ falls in the frame, as long as it has the VBL period.
+ *
+ * Raster mode colors the screen border while the CPU is busy and
+ * switches to another color while waiting: the height of the busy band
+ * shows the frame load directly on screen (1 scanline = 64 cycles).
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_FRAME_H
+#define MO5_FRAME_H
+
+#include "mo5_video.h"
+#include "mo5_tick.h"
+
+// ============================================================================
+// TIMING
+// ============================================================================
+
+#define MO5_FRAME_CYCLES  20000   // CPU cycles per frame (1 MHz / 50 Hz)
+
+// ============================================================================
+// STATISTICS
+// ============================================================================
+
+/**
+ * Frame statistics, updated by mo5_wait_vbl().
+ *
+ * idle_spins / min_idle_spins / full_spins share the same unit
+ * (one iteration of the VBL polling loop, ~20 cycles).
+ */
+typedef struct {
+    unsigned int frames;          // Frames waited since reset
+    unsigned int overruns;        // Frames that missed their VBL (needs mo5_frame_init)
+    unsigned int idle_spins;      // Idle time of the last frame
+    unsigned int min_idle_spins;  // Idle time of the busiest frame since reset
+    unsigned int full_spins;      // Idle time of an empty frame (mo5_frame_calibrate)
+} MO5_FrameStats;
+
+extern MO5_FrameStats mo5_frame_stats;
+
+/** VBL counter, incremented by the 50 Hz IRQ once mo5_frame_init() is called. */
+#define mo5_frame_vbl  mo5_tick_count
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Resets the statistics, measures an empty frame, then starts the 50 Hz
+ * tick to count VBLs (enables overrun detection).
+ * Call once after mo5_video_init().
+ */
+void mo5_frame_init(void);
+
+/** Releases the tick (the monitor routine is restored if no one else uses it). */
+void mo5_frame_shutdown(void);
+
+/** Clears frames, overruns and min_idle_spins (full_spins is kept). */
+void mo5_frame_reset(void);
+
+/**
+ * Measures the idle spins of an empty frame (waits 2 VBLs).
+ * Called by mo5_frame_init(); call again if the interrupt load changes.
+ */
+void mo5_frame_calibrate(void);
+
+/**
+ * @return CPU load of the last frame in percent (0-100),
+ *         0 if mo5_frame_calibrate() was never called.
+ */
+unsigned char mo5_frame_load(void);
+
+/**
+ * Enables the raster bar: border set to @p busy_color when mo5_wait_vbl()
+ * returns, to @p idle_color while it waits.
+ *
+ * @param busy_color  Border color while the game runs (C_xxx)
+ * @param idle_color  Border color while waiting for the VBL (C_xxx)
+ */
+void mo5_frame_raster(unsigned char busy_color, unsigned char idle_color);
+
+/** Disables the raster bar (border left unchanged). */
+void mo5_frame_raster_off(void);
+
+// ============================================================================
+// INTERNAL — called by mo5_wait_vbl()
+// ============================================================================
+
+void mo5_frame_wait_begin(void);
+void mo5_frame_wait_end(unsigned int spins);
+
+/** Internal (mo5_prof): a VBL waited for outside mo5_wait_vbl() is not an overrun. */
+void mo5_frame_resync(void);
+
+#endif // MO5_FRAME_H
@@ -0,0 +1,112 @@
+/**
+ * @file
+ * @brief Non-blocking line editor — one key per frame, drawn with the graphics fonts.
+ *
+ * fgets() blocks until Enter: animations, music and the frame loop stop
+ * while the player types. A MO5_LineEdit is an editing state advanced by
+ * one key per call and redrawn incrementally, so text entry runs inside
+ * the normal VBL-synchronized loop:
+ *
+ *   mo5_lineedit_init(&ed, name, 10, 12, 96, &font8, C_YELLOW);
+ *   while (mo5_lineedit_poll(&ed) == MO5_LE_EDITING) {
+ *       mo5_wait_vbl();
+ *       mo5_lineedit_draw(&ed);
+ *       update_title_screen();
+ *   }
+ *
+ * Keys (MO5 monitor GETC codes):
+ *   printable        insert at the cursor
+ *   MO5_KEY_LEFT / MO5_KEY_RIGHT   move the cursor
+ *   MO5_KEY_UP / MO5_KEY_DOWN      start / end of the line
+ *   MO5_KEY_DEL      erase the character before the cursor
+ *   MO5_ENTER_CHAR   finish editing
+ *
+ * The field occupies max_len + 1 character cells (the cursor can sit
+ * after the last character). Only cells changed since the last draw are
+ * redrawn: a key costs at most the cells from the cursor to the end.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_LINEEDIT_H
+#define MO5_LINEEDIT_H
+
+#include "mo5_defs.h"
+#include "mo5_font6.h"
+#include "mo5_font8.h"
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+#define MO5_LE_EDITING     0   // mo5_lineedit_poll / key: still editing
+#define MO5_LE_DONE        1   // Enter pressed, buf holds the line
+
+#define MO5_LE_BLINK       16  // Cursor half-period in frames (power of 2)
+
+// ============================================================================
+// STRUCTURES
+// ============================================================================
+
+/**
+ * Font used to draw the field. Declare one with the macros below:
+ *   static const MO5_LineEditFont font8 = MO5_LINEEDIT_FONT8;
+ */
+typedef struct {
+    void (*puts)(unsigned char tx, unsigned char ty,
+                 const char *s, unsigned char fg_color);
+    unsigned char height;            // Glyph height in pixel rows
+} MO5_LineEditFont;
+
+#define MO5_LINEEDIT_FONT6  { mo5_font6_puts, 6 }
+#define MO5_LINEEDIT_FONT8  { mo5_font8_puts, 8 }
+
+/**
+ * Line editor state.
+ * Must be initialized with mo5_lineedit_init() before any use.
+ */
+typedef struct {
+    char                   *buf;        // max_len + 1 bytes, always terminated
+    const MO5_LineEditFont *font;
+    unsigned char           max_len;
+    unsigned char           len;
+    unsigned char           cursor;     // 0..len
+    unsigned char           tx;         // Field position (bytes, pixel rows)
+    unsigned char           ty;
+    unsigned char           color;      // Text color (C_xxx)
+    unsigned char           dirty_from; // Cells to redraw [from, to]; from > to: none
+    unsigned char           dirty_to;
+    unsigned char           blink;      // Frame counter for the cursor
+    unsigned char           done;       // Enter pressed
+} MO5_LineEdit;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Starts editing an empty line of at most @p max_len characters in
+ * @p buf (max_len + 1 bytes) at (@p tx, @p ty). The whole field is drawn
+ * by the next mo5_lineedit_draw().
+ */
+void mo5_lineedit_init(MO5_LineEdit *ed, char *buf, unsigned char max_len,
+                       unsigned char tx, unsigned char ty,
+                       const MO5_LineEditFont *font, unsigned char color);
+
+/**
+ * Applies one key code (0: no key). Never blocks.
+ * @return MO5_LE_DONE once Enter has been pressed, MO5_LE_EDITING otherwise.
+ */
+unsigned char mo5_lineedit_key(MO5_LineEdit *ed, char key);
+
+/** Reads one key with mo5_getchar() (non-blocking) and applies it. */
+unsigned char mo5_lineedit_poll(MO5_LineEdit *ed);
+
+/**
+ * Redraws the changed cells and blinks the cursor. Call once per frame,
+ * after mo5_wait_vbl(). The cursor is hidden once editing is done.
+ */
+void mo5_lineedit_draw(MO5_LineEdit *ed);
+
+#endif // MO5_LINEEDIT_H
@@ -0,0 +1,72 @@
+/**
+ * @file
+ * @brief LZ decompressor for packed sprites and screens (scripts/mo5lz.py format).
+ *
+ * Byte-oriented format, no bit extraction — fast on the 6809:
+ *
+ *   header   : unpacked size, 2 bytes big-endian
+ *   0nnnnnnn : nnnnnnn+1 literal bytes follow          (1..128)
+ *   1nnnnnnn hi lo : copy nnnnnnn+3 bytes from output - hi:lo (3..130)
+ *
+ * Back-references read the output itself: a stream can be unpacked
+ * straight into a VRAM bank or into an arena block, with no
+ * intermediate buffer.
+ *
+ * Generated by: python3 scripts/png2mo5.py image.png --compress
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_LZ_H
+#define MO5_LZ_H
+
+#include "mo5_sprite_types.h"
+#include "mo5_arena.h"
+
+// ============================================================================
+// STRUCTURE
+// ============================================================================
+
+/**
+ * Packed sprite (static resource).
+ * Initialize with the SPRITE_XXX_PACKED_INIT macro of the generated .h.
+ */
+typedef struct {
+    const unsigned char *form_lz;     // Packed form plane
+    const unsigned char *color_lz;    // Packed color plane
+    unsigned char        width_bytes; // Width in bytes (1-40)
+    unsigned char        height;      // Height in pixel rows (1-200)
+} MO5_PackedSprite;
+
+/** Unpacked size of a stream, read from its header. */
+#define MO5_LZ_SIZE(src)  (((unsigned int)(src)[0] << 8) | (src)[1])
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Unpacks a stream to @p dst.
+ * If @p dst is in VRAM, the bank must be selected (PRC) before the call.
+ *
+ * @return Number of bytes written.
+ */
+unsigned int mo5_lz_unpack(const unsigned char *src, unsigned char *dst);
+
+/**
+ * Unpacks a full-screen image (8000 bytes per plane) straight into
+ * both VRAM banks.
+ */
+void mo5_lz_unpack_screen(const unsigned char *form_lz, const unsigned char *color_lz);
+
+/**
+ * Allocates both planes of @p packed from @p arena, unpacks them,
+ * and fills @p out so it can be drawn by any sprite engine.
+ *
+ * @return 1 on success, 0 if the arena is too small (nothing allocated).
+ */
+unsigned char mo5_lz_unpack_sprite(MO5_Arena *arena, const MO5_PackedSprite *packed,
+                                   MO5_Sprite *out);
+
+#endif // MO5_LZ_H
@@ -0,0 +1,108 @@
+/**
+ * @file
+ * @brief Fixed-capacity object pool — O(1) alloc/free, dense iteration.
+ *
+ * Storage is provided by the caller (static array of any object type:
+ * MO5_Actor, MO5_Actor_DR, bullets, particles...).
+ *
+ * Free slots are chained through their own first two bytes (intrusive
+ * free list): no extra memory per slot, alloc/free in constant time.
+ * Live objects are kept packed in the `live` pointer array, so a
+ * per-frame loop only visits live objects instead of scanning the
+ * whole capacity with an "active" flag.
+ *
+ * Typical usage:
+ *   static Bullet  bullets[16];
+ *   static void   *bullets_live[16];
+ *   static MO5_Pool bullet_pool;
+ *
+ *   mo5_pool_init(&bullet_pool, bullets, sizeof(Bullet), 16, bullets_live);
+ *
+ *   i = MO5_POOL_COUNT(&bullet_pool);
+ *   while (i--) {                               // backwards: free-safe
+ *       Bullet *b = (Bullet *)MO5_POOL_AT(&bullet_pool, i);
+ *       if (update_bullet(b) == 0) mo5_pool_free(&bullet_pool, i);
+ *   }
+ *
+ * Constraint: slot_size >= 2 (a slot must hold a pointer when free).
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_POOL_H
+#define MO5_POOL_H
+
+#include <cmoc.h>
+
+// ============================================================================
+// STRUCTURE
+// ============================================================================
+
+/**
+ * Pool descriptor.
+ *
+ * free_head : first free slot (NULL when the pool is full)
+ * live      : caller-provided array of `capacity` pointers, live objects
+ *             packed at indices [0, count)
+ *
+ * Must be initialized with mo5_pool_init() before any use.
+ */
+typedef struct {
+    unsigned char  *storage;    // Caller-provided slots
+    unsigned char  *free_head;  // Intrusive free list
+    void          **live;       // Dense array of live objects
+    unsigned int    slot_size;  // Size of one slot in bytes (>= 2)
+    unsigned char   capacity;   // Number of slots (1-255)
+    unsigned char   count;      // Number of live objects
+} MO5_Pool;
+
+// ============================================================================
+// ITERATION
+// ============================================================================
+
+/** Number of live objects. */
+#define MO5_POOL_COUNT(pool)   ((pool)->count)
+
+/** Live object at dense index @p i (0 <= i < count). */
+#define MO5_POOL_AT(pool, i)   ((pool)->live[(i)])
+
+/** 1 if no slot is left, 0 otherwise. */
+#define MO5_POOL_FULL(pool)    ((pool)->free_head == NULL)
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Initializes the pool over caller-provided storage.
+ * All slots are free after this call.
+ *
+ * @param pool       Pool descriptor.
+ * @param storage    Array of @p capacity objects of @p slot_size bytes.
+ * @param slot_size  sizeof() the object type (>= 2).
+ * @param capacity   Number of slots (1-255).
+ * @param live       Array of @p capacity pointers (dense live list).
+ */
+void mo5_pool_init(MO5_Pool *pool, void *storage, unsigned int slot_size,
+                   unsigned char capacity, void **live);
+
+/**
+ * Takes a free slot and appends it to the live list.
+ * The content of the slot is undefined — initialize it after the call.
+ *
+ * @return Pointer to the slot, or NULL if the pool is full.
+ */
+void *mo5_pool_alloc(MO5_Pool *pool);
+
+/**
+ * Releases the live object at dense index @p index.
+ * The last live object is moved into @p index (swap-remove):
+ * when freeing during iteration, iterate from count-1 down to 0.
+ */
+void mo5_pool_free(MO5_Pool *pool, unsigned char index);
+
+/** Releases every live object (e.g. at level change). */
+void mo5_pool_clear(MO5_Pool *pool);
+
+#endif // MO5_POOL_H
@@ -0,0 +1,113 @@
+/**
+ * @file
+ * @brief Named profiling zones — per-zone cycle cost and budget.
+ *
+ * Splits the 20,000 cycles of a frame between zones (logic, restore,
+ * draw, HUD...). Zones are declared with MO5_PROF_ZONE and delimited
+ * with MO5_PROF_BEGIN / MO5_PROF_END.
+ *
+ * The MO5 has no readable timer: a zone is measured by "probing".
+ * Every MO5_PROF_PERIOD frames, one zone (round-robin) is probed:
+ *   BEGIN : waits for the start of a frame (t = 0)
+ *   END   : counts idle spins until the next frame
+ *   cost  = (empty-frame spins - remaining spins) x cycles per spin
+ * A probe costs 1-2 dropped frames; the other frames run normally.
+ *
+ * All macros expand to nothing unless MO5_PROFILE is defined:
+ *   cmoc ... -DMO5_PROFILE ...
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_PROF_H
+#define MO5_PROF_H
+
+#include "mo5_frame.h"
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+#define MO5_PROF_MAX_ZONES  8
+#define MO5_PROF_PERIOD     16      // Frames between two probes
+#define MO5_PROF_OVERFLOW   0xFFFF  // Cost of a zone longer than a frame
+
+// ============================================================================
+// STRUCTURE
+// ============================================================================
+
+/**
+ * Profiling zone. All costs are in CPU cycles.
+ */
+typedef struct {
+    const char   *name;     // Label shown by mo5_prof_dump (8 chars max)
+    unsigned int  budget;   // Allowed cycles (0 = no budget)
+    unsigned int  last;     // Cost of the last probe
+    unsigned int  max;      // Highest cost seen
+    unsigned int  avg;      // Moving average (1/8 weight per probe)
+    unsigned char samples;  // Number of probes (saturates at 255)
+    unsigned char over;     // Probes above budget (saturates at 255)
+} MO5_ProfZone;
+
+extern MO5_ProfZone mo5_prof_zones[MO5_PROF_MAX_ZONES];
+
+// ============================================================================
+// MACROS (compiled out without MO5_PROFILE)
+// ============================================================================
+
+#ifdef MO5_PROFILE
+#define MO5_PROF_INIT()                    mo5_prof_init()
+#define MO5_PROF_ZONE(id, name, budget)    mo5_prof_zone((id), (name), (budget))
+#define MO5_PROF_BEGIN(id)                 mo5_prof_begin(id)
+#define MO5_PROF_END(id)                   mo5_prof_end(id)
+#define MO5_PROF_DUMP(tx, ty)              mo5_prof_dump((tx), (ty))
+#define MO5_PROF_PRINT()                   mo5_prof_print()
+#else
+#define MO5_PROF_INIT()
+#define MO5_PROF_ZONE(id, name, budget)
+#define MO5_PROF_BEGIN(id)
+#define MO5_PROF_END(id)
+#define MO5_PROF_DUMP(tx, ty)
+#define MO5_PROF_PRINT()
+#endif
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Clears all zones and measures the empty-frame spin count.
+ * Call after mo5_video_init() (and mo5_frame_init() if used).
+ */
+void mo5_prof_init(void);
+
+/**
+ * Declares zone @p id.
+ *
+ * @param id      Zone index (0 .. MO5_PROF_MAX_ZONES-1)
+ * @param name    Label (static string, 8 chars max)
+ * @param budget  Allowed cycles per frame (0 = none)
+ */
+void mo5_prof_zone(unsigned char id, const char *name, unsigned int budget);
+
+/** Starts zone @p id. Syncs to the next frame when the zone is probed. */
+void mo5_prof_begin(unsigned char id);
+
+/** Ends zone @p id. Measures the zone cost when it is probed. */
+void mo5_prof_end(unsigned char id);
+
+/**
+ * Draws the zone table with mo5_font6 (one line per declared zone):
+ *   NAME     LAST   MAX BUDGET
+ * Zones over budget are drawn in C_LIGHT_RED.
+ *
+ * @param tx  Position in bytes (0..39)
+ * @param ty  Position in pixel rows (0..199)
+ */
+void mo5_prof_dump(unsigned char tx, unsigned char ty);
+
+/** Prints the zone table on the text console (mo5_stdio). */
+void mo5_prof_print(void);
+
+#endif // MO5_PROF_H
@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @brief Color-bank effects — fades, flashes and color cycling through a 256-entry remap table.
+ *
+ * A color byte is FFFFBBBB: changing what a region looks like only needs
+ * the color bank, rewritten through a table that gives the new byte for
+ * each of the 256 old ones. The table is built once per effect step
+ * (fade level, flash color, cycle phase); applying it is a lookup per
+ * byte in an unrolled 6809 loop, and the form bank is never touched.
+ *
+ *   static unsigned char map[MO5_REMAP_SIZE];
+ *   static unsigned char saved[40 * 200];
+ *
+ *   mo5_remap_save(saved, 0, 0, 40, 200);          // original colors
+ *   for (step = 1; step <= MO5_REMAP_FADE_STEPS; step++) {
+ *       mo5_remap_fade(map, step);
+ *       mo5_remap_copy(map, saved, 0, 0, 40, 200); // fade from the original
+ *   }
+ *
+ * Remapping in place (mo5_remap_rect) is lossy unless the table is a
+ * permutation, as for color cycling: to fade back in, or to end a flash,
+ * remap from a copy saved with mo5_remap_save().
+ *
+ * Cost: about 13 cycles per byte, so at most some 1500 bytes per frame; a
+ * full-screen step (8000 bytes) takes 5 frames. Spread a large region
+ * over several frames by bands of rows.
+ *
+ * Table layout: the entry of byte b is at index b ^ 0x80, so that the
+ * loop can index it with a signed accumulator offset (LDB B,Y). Use
+ * MO5_REMAP_AT() to fill a custom table.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_REMAP_H
+#define MO5_REMAP_H
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+#define MO5_REMAP_SIZE        256
+#define MO5_REMAP_FADE_STEPS  4     // mo5_remap_fade: every color is black at this step
+
+/** Entry of color byte @p b in the remap table @p map. */
+#define MO5_REMAP_AT(map, b)  ((map)[(unsigned char)((b) ^ 0x80)])
+
+// ============================================================================
+// TABLE BUILDERS
+// ============================================================================
+
+/**
+ * Builds the table from two 16-entry color tables: every byte becomes
+ * (fg[F] << 4) | bg[B]. @p fg and @p bg may be the same table.
+ */
+void mo5_remap_nibbles(unsigned char *map,
+                       const unsigned char *fg, const unsigned char *bg);
+
+/**
+ * Fade toward black: each color is darkened @p step times (light color,
+ * base color, black). Step 0 is the identity, MO5_REMAP_FADE_STEPS is
+ * all black.
+ */
+void mo5_remap_fade(unsigned char *map, unsigned char step);
+
+/** Every byte becomes COLOR(@p color, @p color): the region is a solid flash. */
+void mo5_remap_flash(unsigned char *map, unsigned char color);
+
+/**
+ * Color cycling: colors[i] becomes colors[(i + @p phase) % @p count], in
+ * both nibbles; the other colors are unchanged. With phase 1 the table is
+ * a permutation and can be applied in place frame after frame.
+ */
+void mo5_remap_cycle(unsigned char *map, const unsigned char *colors,
+                     unsigned char count, unsigned char phase);
+
+// ============================================================================
+// APPLY
+// ============================================================================
+
+/** Remaps the color bank of a screen rectangle in place (x in bytes, y in rows). */
+void mo5_remap_rect(const unsigned char *map,
+                    unsigned char tx, unsigned char ty,
+                    unsigned char w,  unsigned char h);
+
+/**
+ * Writes map[src] to the color bank of a screen rectangle. @p src holds
+ * w * h bytes, row-major, as saved by mo5_remap_save().
+ */
+void mo5_remap_copy(const unsigned char *map, const unsigned char *src,
+                    unsigned char tx, unsigned char ty,
+                    unsigned char w,  unsigned char h);
+
+/** Saves the color bank of a screen rectangle to @p dst (w * h bytes). */
+void mo5_remap_save(unsigned char *dst,
+                    unsigned char tx, unsigned char ty,
+                    unsigned char w,  unsigned char h);
+
+#endif // MO5_REMAP_H
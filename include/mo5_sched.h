@@ -0,0 +1,118 @@
+/**
+ * @file
+ * @brief Cooperative scheduler — stackless resumable tasks, per-frame step budget.
+ *
+ * A task is a function resumed where it last yielded (switch/__LINE__
+ * coroutines, no stack of its own). mo5_sched_run() gives the registered
+ * tasks a number of steps per frame, round-robin; one step runs a task
+ * up to its next MO5_TASK_YIELD.
+ *
+ * The step budget adapts to the frame-time instrumentation (mo5_frame):
+ *   - a frame overrun since the last run halves it
+ *   - a last-frame load under the target (85 % by default) adds one step,
+ *     if the previous run used its whole budget
+ * so background work (level decompression, path search) fills the spare
+ * time without pushing the game under 50 Hz.
+ *
+ * Call mo5_frame_init() first: without it there is no load measure nor
+ * overrun count, and the budget stays at 1 step per frame.
+ *
+ *   static unsigned char unpack_task(MO5_Task *t)
+ *   {
+ *       UnpackJob *job = (UnpackJob *)t->ctx;
+ *       MO5_TASK_BEGIN(t);
+ *       for (job->row = 0; job->row < 200; job->row += 8) {
+ *           unpack_rows(job, 8);
+ *           MO5_TASK_YIELD(t);
+ *       }
+ *       MO5_TASK_END(t);
+ *   }
+ *
+ * Locals do not survive a yield: keep loop counters in the context.
+ * A YIELD may not appear inside a switch statement of the task body.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_SCHED_H
+#define MO5_SCHED_H
+
+#include "mo5_frame.h"
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+#define MO5_SCHED_MAX_TASKS   8
+#define MO5_SCHED_FULL        0xFF   // mo5_sched_add: no free slot
+#define MO5_SCHED_MAX_BUDGET  64     // Steps per frame, upper bound
+
+#define MO5_TASK_RUNNING      0      // Step return: resume later
+#define MO5_TASK_DONE         1      // Step return: finished, removed
+
+// ============================================================================
+// STRUCTURES
+// ============================================================================
+
+typedef struct MO5_Task MO5_Task;
+
+/** One step of a task: runs until the next yield. */
+typedef unsigned char (*MO5_TaskFn)(MO5_Task *task);
+
+/** Task state. Storage is supplied by the caller (static or pool). */
+struct MO5_Task {
+    MO5_TaskFn     fn;
+    void          *ctx;      // Caller data (state that must survive a yield)
+    unsigned int   resume;   // Resume point (__LINE__ of the last yield, 0: start)
+    unsigned char  done;     // Set when the task has finished
+};
+
+// ============================================================================
+// COROUTINE MACROS
+// ============================================================================
+
+#define MO5_TASK_BEGIN(t)        switch ((t)->resume) { case 0:
+
+/** Ends the step; the next step resumes after this line. */
+#define MO5_TASK_YIELD(t)        do { (t)->resume = __LINE__; return MO5_TASK_RUNNING; \
+                                      case __LINE__:; } while (0)
+
+/** Yields until @p cond is true (tested once per step). */
+#define MO5_TASK_WAIT_UNTIL(t, cond) \
+                                 do { (t)->resume = __LINE__; case __LINE__: \
+                                      if (!(cond)) return MO5_TASK_RUNNING; } while (0)
+
+/** Finishes the task. */
+#define MO5_TASK_END(t)          } (t)->resume = 0; return MO5_TASK_DONE
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Registers @p task, started from the top of @p fn with @p ctx.
+ * @return Slot index, or MO5_SCHED_FULL.
+ */
+unsigned char mo5_sched_add(MO5_Task *task, MO5_TaskFn fn, void *ctx);
+
+/** Unregisters @p task before it finishes (no-op if absent). */
+void mo5_sched_remove(MO5_Task *task);
+
+/**
+ * Adapts the budget to the last frame, then runs up to that many steps.
+ * Call once per frame, after drawing.
+ * @return Steps run (0: no task registered).
+ */
+unsigned char mo5_sched_run(void);
+
+/** @return Number of registered, unfinished tasks. */
+unsigned char mo5_sched_pending(void);
+
+/** Current steps-per-frame budget. */
+unsigned char mo5_sched_budget(void);
+
+/** Sets the target frame load in percent (default 85). */
+void mo5_sched_target(unsigned char load_percent);
+
+#endif // MO5_SCHED_H
@@ -0,0 +1,72 @@
+/**
+ * @file
+ * @brief Full-screen RLE / delta images decoded row by row into VRAM
+ *        (scripts/mo5screen.py format).
+ *
+ * Each pixel row is stored as a COLOR segment then a FORM segment:
+ *
+ *   00nnnnnn   : nnnnnn+1 literal bytes follow     (1..40)
+ *   01nnnnnn v : nnnnnn+1 copies of v              (1..40)
+ *   10nnnnnn   : skip nnnnnn+1 unchanged bytes     (1..40)
+ *   11000000   : end of segment, rest of row unchanged
+ *
+ * At the start of a row only:
+ *
+ *   11nnnnnn   : nnnnnn whole rows unchanged       (1..63)
+ *
+ * A full screen only uses literals and fills. A delta screen
+ * (png2mo5.py --screen --delta-from prev.png) only encodes the bytes
+ * that differ from the previous screen, and must be drawn over it.
+ *
+ * Both banks of a row are written before moving to the next one: the
+ * new image appears top to bottom without color artifacts, and no
+ * buffer is needed.
+ *
+ * Generated by: python3 scripts/png2mo5.py title.png --screen
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_SCREEN_H
+#define MO5_SCREEN_H
+
+#include "mo5_video.h"
+
+// ============================================================================
+// STRUCTURE
+// ============================================================================
+
+/**
+ * Decoding cursor, for transitions spread over several frames.
+ * Initialize with mo5_screen_begin().
+ */
+typedef struct {
+    const unsigned char *src;   // Next byte of the stream
+    unsigned char        row;   // Next pixel row to decode (>= SCREEN_HEIGHT: done)
+} MO5_ScreenCursor;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Decodes a full or delta screen straight into both VRAM banks.
+ * Leaves the form bank selected.
+ *
+ * @param stream  screen_xxx_rle array generated by png2mo5.py --screen.
+ */
+void mo5_screen_draw(const unsigned char *stream);
+
+/** Starts a step-by-step decode of @p stream (nothing is drawn). */
+void mo5_screen_begin(MO5_ScreenCursor *cur, const unsigned char *stream);
+
+/**
+ * Decodes up to @p rows pixel rows, e.g. 20 rows per frame after
+ * mo5_wait_vbl() for a 10-frame wipe. Leaves the form bank selected.
+ *
+ * @return 1 while rows remain, 0 once the screen is complete.
+ */
+unsigned char mo5_screen_step(MO5_ScreenCursor *cur, unsigned char rows);
+
+#endif // MO5_SCREEN_H
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @brief Shadow-RAM compositing — sprites composed off screen, changed spans flushed to VRAM.
+ *
+ * A shadow covers a screen region (typically the playfield) with a RAM
+ * copy of both banks. Sprites are restored and drawn in RAM, in any
+ * order and with any overlap; every write widens the dirty span of the
+ * rows it touches. mo5_shadow_flush() then copies only those spans to
+ * VRAM, color bank first, form bank second, and resets them.
+ *
+ * Compared with mo5_actor_dr, no VRAM is read back and nothing is saved
+ * per sprite: the background is a RAM copy of the region, and the screen
+ * only ever receives finished pixels (no clear/draw flicker).
+ *
+ * Memory: 2 x w x h bytes for the composite, 2 x w x h for the optional
+ * background copy, 2 x h for the span table (a 24 x 128 playfield needs
+ * 6 KB composite + 6 KB background).
+ *
+ * Typical frame:
+ *   mo5_shadow_restore(&sh, old_x, old_y, w, h);   // for every sprite
+ *   mo5_shadow_draw(&sh, x, y, &spr_hero);         // for every sprite
+ *   mo5_wait_vbl();
+ *   mo5_shadow_flush(&sh);
+ *
+ * Coordinates are screen coordinates (x in bytes, y in rows). Sprites
+ * must lie entirely inside the region: there is no clipping.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_SHADOW_H
+#define MO5_SHADOW_H
+
+#include "mo5_sprite_types.h"
+
+// ============================================================================
+// STRUCTURES
+// ============================================================================
+
+/** Dirty span of one region row: bytes [x0, x1) changed. Clean if x0 >= x1. */
+typedef struct {
+    unsigned char x0;
+    unsigned char x1;
+} MO5_ShadowSpan;
+
+/** Off-screen composite of a screen region. Storage is supplied by the caller. */
+typedef struct {
+    unsigned char        *form;       // w * h bytes, row-major
+    unsigned char        *color;      // w * h bytes, row-major
+    const unsigned char  *bg_form;    // Background copy (NULL: none)
+    const unsigned char  *bg_color;
+    MO5_ShadowSpan       *spans;      // h entries
+    unsigned char         x;          // Region position on screen (bytes, rows)
+    unsigned char         y;
+    unsigned char         w;          // Region size (bytes, rows)
+    unsigned char         h;
+} MO5_Shadow;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Sets up a shadow over the region (@p x, @p y, @p w, @p h). The
+ * composite is not initialized: call mo5_shadow_fill() or
+ * mo5_shadow_restore() on the whole region before the first flush.
+ */
+void mo5_shadow_init(MO5_Shadow *sh,
+                     unsigned char x, unsigned char y,
+                     unsigned char w, unsigned char h,
+                     unsigned char *form, unsigned char *color,
+                     MO5_ShadowSpan *spans);
+
+/**
+ * Background copied by mo5_shadow_restore(): two w * h buffers with the
+ * region layout (e.g. built once with mo5_shadow_draw_opaque on a
+ * scratch shadow, or decompressed level data).
+ */
+void mo5_shadow_set_background(MO5_Shadow *sh,
+                               const unsigned char *bg_form,
+                               const unsigned char *bg_color);
+
+/** Fills the whole composite with @p color (form 0) and marks it dirty. */
+void mo5_shadow_fill(MO5_Shadow *sh, unsigned char color);
+
+/** Copies a rectangle of the background into the composite. */
+void mo5_shadow_restore(MO5_Shadow *sh,
+                        unsigned char tx, unsigned char ty,
+                        unsigned char w,  unsigned char h);
+
+/**
+ * Draws a sprite with transparency: groups whose foreground is 0 are
+ * skipped; the others take the sprite foreground over the composite
+ * background nibble, and the sprite form replaces the composite form
+ * (the sprite drawn last is on top, without |= accumulation).
+ */
+void mo5_shadow_draw(MO5_Shadow *sh, unsigned char tx, unsigned char ty,
+                     const MO5_Sprite *sprite);
+
+/** Draws a sprite as is (both banks copied). */
+void mo5_shadow_draw_opaque(MO5_Shadow *sh, unsigned char tx, unsigned char ty,
+                            const MO5_Sprite *sprite);
+
+/**
+ * Copies the dirty spans to VRAM and resets them. Call right after
+ * mo5_wait_vbl(): the copy cost is proportional to the changed bytes.
+ */
+void mo5_shadow_flush(MO5_Shadow *sh);
+
+#endif // MO5_SHADOW_H
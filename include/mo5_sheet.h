@@ -0,0 +1,61 @@
+/**
+ * @file
+ * @brief Sprite sheets — deduplicated animation frames in one data blob.
+ *
+ * Generated by: python3 scripts/png2mo5.py hero.png --sheet 16x24
+ *
+ * The PNG is sliced into equally sized frames (left to right, top to
+ * bottom). Identical form planes and identical color planes are stored
+ * once in sheet_xxx_data; the frame table gives, for each frame, the
+ * offsets of its two planes from that single base pointer.
+ *
+ *   MO5_SpriteSheet hero_sheet = SHEET_HERO_INIT;
+ *   MO5_Sprite      frame;
+ *
+ *   mo5_sheet_frame(&hero_sheet, 3, &frame);   // points into the blob
+ *   mo5_draw_sprite(x, y, frame.form, frame.color,
+ *                   frame.width_bytes, frame.height);
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_SHEET_H
+#define MO5_SHEET_H
+
+#include "mo5_sprite_types.h"
+
+// ============================================================================
+// STRUCTURES
+// ============================================================================
+
+/** One frame: offsets of its planes in the sheet data blob. */
+typedef struct {
+    unsigned int form;          // Offset of the form plane
+    unsigned int color;         // Offset of the color plane
+} MO5_SheetFrame;
+
+/**
+ * Sprite sheet (static resource).
+ * Every frame has the same size.
+ * Initialize with the SHEET_XXX_INIT macro of the generated .h.
+ */
+typedef struct {
+    unsigned char        *data;        // Deduplicated planes (single base pointer)
+    const MO5_SheetFrame *frames;      // Frame table
+    unsigned char         width_bytes; // Frame width in bytes (1-40)
+    unsigned char         height;      // Frame height in pixel rows (1-200)
+    unsigned char         count;       // Number of frames
+} MO5_SpriteSheet;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Fills @p out with frame @p index of @p sheet (no copy: the planes
+ * point into the sheet data). @p index must be < sheet->count.
+ */
+void mo5_sheet_frame(const MO5_SpriteSheet *sheet, unsigned char index, MO5_Sprite *out);
+
+#endif // MO5_SHEET_H
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @brief Buzzer sound — note tables (music and effects) played from the 50 Hz tick.
+ *
+ * The MO5 buzzer is a single output bit: a tone exists only while the CPU
+ * toggles it. Instead of busy-wait tone loops in the main code, the player
+ * is a mo5_tick hook: on every tick it plays one burst of the current note
+ * (a fixed number of CPU cycles, mo5_sound_set_burst) and steps the note
+ * timers. The cost per frame is bounded and known, whatever is playing.
+ *
+ * A tune is a table of MO5_Note {period, ticks} ended by MO5_NOTE_END,
+ * generated by scripts/mo5tune.py from a text notation:
+ *
+ *   mo5_sound_init();
+ *   mo5_sound_music(tune_theme, 1);     // loops
+ *   ...
+ *   mo5_sound_sfx(tune_jump);           // covers the music, which keeps its tempo
+ *
+ * Two channels share the buzzer: an effect, when active, is heard instead
+ * of the music; the music timers keep running underneath.
+ *
+ * Burst trade-off: the tone is heard burst cycles out of 20000 per frame,
+ * chopped at 50 Hz. Low notes need long bursts (a 3000-cycle burst holds
+ * one period of a 330 Hz note): raise the burst on title screens, lower it
+ * in game.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_SOUND_H
+#define MO5_SOUND_H
+
+// ============================================================================
+// HARDWARE
+// ============================================================================
+
+#define MO5_SOUND_PORT  ((unsigned char *)0xA7C1)   // System PIA port B
+#define MO5_SOUND_BIT   0x01                         // Bit 0: buzzer output
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+// Half period of a tone, in CPU cycles: HALF_BASE + HALF_STEP * period
+// (1 MHz clock: frequency = 1000000 / (2 * (HALF_BASE + HALF_STEP * period))).
+#define MO5_SOUND_HALF_BASE   22
+#define MO5_SOUND_HALF_STEP   8
+#define MO5_SOUND_MAX_PERIOD  8000    // Bound of the burst division; longer periods play as rests
+
+// A note is heard only if a burst holds at least 2 half periods:
+// period <= (burst / 2 - HALF_BASE) / HALF_STEP, i.e. 247 (~250 Hz) at the
+// default burst. Below, it plays as a rest, or a 25 Hz click for 1 half.
+
+#define MO5_SOUND_BURST       4000    // Default burst: cycles of tone per tick (20 % of a frame)
+
+#define MO5_NOTE_REST   0             // period of a silent note
+#define MO5_NOTE_END    { 0, 0 }      // Table terminator (ticks == 0)
+
+// mo5_sound_playing() flags
+#define MO5_SOUND_MUSIC 0x01
+#define MO5_SOUND_SFX   0x02
+
+// ============================================================================
+// STRUCTURES
+// ============================================================================
+
+/** One note: delay count of a half period (0: rest) and duration in ticks (0: end). */
+typedef struct {
+    unsigned int  period;
+    unsigned char ticks;
+} MO5_Note;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * Installs the player on the 50 Hz tick (calls mo5_tick_init).
+ * @return 1, or 0 if no tick hook slot is free.
+ */
+unsigned char mo5_sound_init(void);
+
+/** Silences the buzzer and removes the player from the tick. */
+void mo5_sound_shutdown(void);
+
+/** Starts @p song from its first note; it restarts at the end if @p loop is non-zero. */
+void mo5_sound_music(const MO5_Note *song, unsigned char loop);
+
+/** Stops the music (an effect in progress keeps playing). */
+void mo5_sound_stop_music(void);
+
+/**
+ * Plays @p sfx once, over the music. Replaces the effect in progress.
+ * Like mo5_sound_music(), safe to call from a mo5_tick hook.
+ */
+void mo5_sound_sfx(const MO5_Note *sfx);
+
+/** Stops music and effect. */
+void mo5_sound_stop(void);
+
+/** @return MO5_SOUND_MUSIC and/or MO5_SOUND_SFX for the channels still playing. */
+unsigned char mo5_sound_playing(void);
+
+/**
+ * Sets the tone cycles spent per tick (default MO5_SOUND_BURST). Applies
+ * from the next note. 0 mutes the buzzer while the timers keep running.
+ */
+void mo5_sound_set_burst(unsigned int cycles);
+
+#endif // MO5_SOUND_H
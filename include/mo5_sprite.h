@@ -38,6 +38,22 @@ void mo5_move_sprite(unsigned char old_tx, unsigned char old_ty,
                      unsigned char *form_data, unsigned char *color_data,
                      unsigned char width_bytes, unsigned char height);
 
+/**
+ * Mirrored variants (@p flip: MO5_FLIP_H | MO5_FLIP_V).
+ * Same VRAM writes as the plain versions; the form bank costs one table
+ * lookup per byte when flipped horizontally.
+ */
+void mo5_draw_sprite_flip(unsigned char tx, unsigned char ty,
+                          unsigned char *form_data, unsigned char *color_data,
+                          unsigned char width_bytes, unsigned char height,
+                          unsigned char flip);
+
+void mo5_move_sprite_flip(unsigned char old_tx, unsigned char old_ty,
+                          unsigned char new_tx,  unsigned char new_ty,
+                          unsigned char *form_data, unsigned char *color_data,
+                          unsigned char width_bytes, unsigned char height,
+                          unsigned char flip);
+
 // ============================================================================
 // ACTOR API (game level)
 // ============================================================================
@@ -51,4 +67,14 @@ void mo5_actor_clear(const MO5_Actor *actor);
  */
 void mo5_actor_move(MO5_Actor *actor, unsigned char new_x, unsigned char new_y);
 
+void mo5_actor_draw_flip(const MO5_Actor *actor, unsigned char flip);
+
+/**
+ * Moves the actor to (new_x, new_y), drawn with @p flip.
+ * Redraws in place if the position is unchanged (the direction may have
+ * changed): call it only when position or direction changed.
+ */
+void mo5_actor_move_flip(MO5_Actor *actor, unsigned char new_x, unsigned char new_y,
+                         unsigned char flip);
+
 #endif // MO5_SPRITE_H
@@ -8,6 +8,10 @@
  *               → ignores the sprite background (robust against asset bugs)
  * Draw  form  : |= form_data
  * Clear form  : = 0x00  (single pass — color bank not touched)
+ * Move        : clears only the form bytes the new position does not
+ *               cover; the overlap is redrawn with = instead of |=
+ * Flip        : same draw, source read right-to-left (form bits reversed
+ *               through mo5_flip_lut) and/or bottom-up
  *
  * Asset convention: color data background bits must be 0x0 (--bg-color 0 at conversion).
  *
@@ -31,11 +35,18 @@ void mo5_draw_sprite_bg(unsigned char tx, unsigned char ty,
 void mo5_clear_sprite_bg(unsigned char tx, unsigned char ty,
                          unsigned char width_bytes, unsigned char height);
 
+/** Same result as clear + draw, with fewer VRAM writes for small steps. */
 void mo5_move_sprite_bg(unsigned char old_tx, unsigned char old_ty,
                         unsigned char new_tx,  unsigned char new_ty,
                         unsigned char *form_data, unsigned char *color_data,
                         unsigned char width_bytes, unsigned char height);
 
+/** Mirrored draw (@p flip: MO5_FLIP_H | MO5_FLIP_V). Clear is unchanged. */
+void mo5_draw_sprite_bg_flip(unsigned char tx, unsigned char ty,
+                             unsigned char *form_data, unsigned char *color_data,
+                             unsigned char width_bytes, unsigned char height,
+                             unsigned char flip);
+
 // ============================================================================
 // ACTOR API (game level)
 // ============================================================================
@@ -49,4 +60,13 @@ void mo5_actor_clear_bg(const MO5_Actor *actor);
  */
 void mo5_actor_move_bg(MO5_Actor *actor, unsigned char new_x, unsigned char new_y);
 
+void mo5_actor_draw_bg_flip(const MO5_Actor *actor, unsigned char flip);
+
+/**
+ * Moves the actor to (new_x, new_y), drawn with @p flip: full clear of the
+ * old rectangle, then draw. Redraws even if the position is unchanged.
+ */
+void mo5_actor_move_bg_flip(MO5_Actor *actor, unsigned char new_x, unsigned char new_y,
+                            unsigned char flip);
+
 #endif // MO5_SPRITE_BG_H
@@ -31,6 +31,7 @@ void mo5_draw_sprite_form(unsigned char tx, unsigned char ty,
 void mo5_clear_sprite_form(unsigned char tx, unsigned char ty,
                            unsigned char width_bytes, unsigned char height);
 
+/** Clears only the strips uncovered by the move, then draws. */
 void mo5_move_sprite_form(unsigned char old_tx, unsigned char old_ty,
                           unsigned char new_tx,  unsigned char new_ty,
                           unsigned char *form_data,
@@ -62,6 +62,23 @@ typedef struct {
     MO5_Position      old_pos;  // Previous position (managed by mo5_actor_move)
 } MO5_Actor;
 
+// ============================================================================
+// MIRRORING
+// ============================================================================
+
+/*
+ * Flip flags for the *_flip draw paths (mo5_sprite, mo5_sprite_bg,
+ * mo5_actor_dr): one asset serves both facing directions.
+ *   H : byte order reversed per row, form bits reversed via mo5_flip_lut
+ *   V : rows read bottom-up
+ */
+#define MO5_FLIP_NONE  0x00
+#define MO5_FLIP_H     0x01
+#define MO5_FLIP_V     0x02
+
+/** mo5_flip_lut[b] = b with its 8 bits in reverse order. */
+extern const unsigned char mo5_flip_lut[256];
+
 // ============================================================================
 // GENERIC ACTOR FUNCTIONS
 // ============================================================================
@@ -0,0 +1,37 @@
+/**
+ * @file
+ * @brief Fast string and memory routines — 6809 assembly loops.
+ *
+ * Drop-in equivalents of strlen / strcpy / memcpy / memset. Each call
+ * costs one C prologue; the loop itself runs in registers:
+ *   mo5_strlen  : LDA ,X+ / BNE                 ~9 cycles per byte
+ *   mo5_strcpy  : LDA ,X+ / STA ,Y+ / BNE       ~15 cycles per byte
+ *   mo5_memcpy  : PULU D,X / STD ,Y++ / STX ,Y++, 4 bytes per turn (~9 cycles per byte)
+ *   mo5_memset  : PSHU D,X twice, 8 bytes per turn (~3.5 cycles per byte)
+ *
+ * Strings stay byte loops: testing both halves of a 16-bit load for the
+ * terminator costs as much as two byte loads. Block copies and fills use
+ * the U stack instructions, so the U frame pointer is saved around them.
+ *
+ * mo5_memcpy does not handle overlapping buffers.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_STRING_H
+#define MO5_STRING_H
+
+/** @return Length of @p str, terminator excluded. */
+unsigned int mo5_strlen(const char *str);
+
+/** Copies @p src, terminator included, to @p dst. @return dst. */
+char *mo5_strcpy(char *dst, const char *src);
+
+/** Copies @p n bytes from @p src to @p dst (no overlap). @return dst. */
+void *mo5_memcpy(void *dst, const void *src, unsigned int n);
+
+/** Fills @p n bytes at @p dst with @p value. @return dst. */
+void *mo5_memset(void *dst, unsigned char value, unsigned int n);
+
+#endif // MO5_STRING_H
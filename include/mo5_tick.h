@@ -0,0 +1,88 @@
+/**
+ * @file
+ * @brief 50 Hz tick — timer interrupt counter, IRQ hooks, frame sleep and drop count.
+ *
+ * mo5_tick_init() installs a routine on the monitor user timer (TIMEPT),
+ * called on every 50 Hz IRQ. The routine increments mo5_tick_count and
+ * runs the registered hooks (music, input sampling...), so they keep
+ * their rate whatever the main loop does.
+ *
+ * mo5_tick_wait() replaces the VBL busy-poll for loops that do not need
+ * the mo5_frame idle statistics: the CPU sleeps in CWAI until the next
+ * tick, and the return value is the number of ticks elapsed since the
+ * previous wait (> 1: frames were dropped, counted in mo5_tick_dropped).
+ *
+ *   mo5_tick_init();
+ *   mo5_tick_add(music_update);
+ *   for (;;) {
+ *       unsigned char dt = mo5_tick_wait();
+ *       update(dt);                 // catch up on dropped frames
+ *       draw();
+ *   }
+ *
+ * The tick is shared: mo5_frame_init() uses it for overrun detection.
+ * Each mo5_tick_init() must be paired with a mo5_tick_shutdown(); the
+ * monitor routine is restored by the last one.
+ *
+ * Hooks run with IRQs masked, in the middle of any main-loop code: keep
+ * them short and leave PRC (VRAM bank) as they found it.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#ifndef MO5_TICK_H
+#define MO5_TICK_H
+
+// ============================================================================
+// MONITOR HOOKS
+// ============================================================================
+
+#define MON_STATUS     ((unsigned char *)0x2019)     // Monitor status byte
+#define MON_TIMEPT     ((void (**)(void))0x2061)     // User routine called on the 50 Hz IRQ
+#define MON_TIMER_BIT  0x20                           // STATUS bit 5: call TIMEPT
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+#define MO5_TICK_MAX_HOOKS  4      // Hooks called on every tick
+#define MO5_TICK_FULL       0xFF   // mo5_tick_add: no free slot
+
+// ============================================================================
+// STATE
+// ============================================================================
+
+/** Ticks since boot (wraps at 65536), incremented by the 50 Hz IRQ. */
+extern volatile unsigned int mo5_tick_count;
+
+/** Ticks missed by the main loop, accumulated by mo5_tick_wait(). */
+extern unsigned int mo5_tick_dropped;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/** Hooks the monitor 50 Hz timer routine (once; nested calls are counted). */
+void mo5_tick_init(void);
+
+/** Releases one mo5_tick_init(); the last one restores the monitor routine. */
+void mo5_tick_shutdown(void);
+
+/**
+ * Registers @p fn to be called on every tick, after the counter update.
+ * @return Slot index, or MO5_TICK_FULL if MO5_TICK_MAX_HOOKS are in use.
+ */
+unsigned char mo5_tick_add(void (*fn)(void));
+
+/** Unregisters @p fn (no-op if absent). */
+void mo5_tick_remove(void (*fn)(void));
+
+/**
+ * Sleeps until at least one tick has elapsed since the previous call.
+ * Falls back to mo5_wait_vbl() (returning 1) if the tick is not installed.
+ * @return Ticks elapsed (1 when the loop keeps up; capped at 255).
+ */
+unsigned char mo5_tick_wait(void);
+
+#endif // MO5_TICK_H
@@ -15,11 +15,12 @@
 // HARDWARE REGISTERS
 // ============================================================================
 
-#define PRC       ((unsigned char *)0xA7C0)  // VRAM bank select (bit0: 0=color, 1=form)
+#define PRC       ((unsigned char *)0xA7C0)  // VRAM bank select (bit0: 0=color, 1=form), bits1-4: border color
 #define VIDEO_REG ((unsigned char *)0xA7E7)  // Video mode register
 #define VRAM      ((unsigned char *)0x0000)  // Video memory base address
 #define VBL_REG   ((unsigned char *)0xA7E7)  // VBL status register (bit7=1 during blanking)
 #define VBL_BIT   0x80
+#define BORDER_MASK 0x1E                      // PRC bits 1-4: screen border color
 
 // ============================================================================
 // 16-COLOR PALETTE
@@ -61,6 +62,10 @@
 
 extern unsigned int row_offsets[SCREEN_HEIGHT];
 
+/** VRAM address of row @p y / of byte (@p x, @p y). Shared by every engine. */
+#define VRAM_ROW(y)      (VRAM + row_offsets[y])
+#define VRAM_ADDR(x, y)  (VRAM + row_offsets[y] + (x))
+
 // ============================================================================
 // FUNCTIONS
 // ============================================================================
@@ -91,9 +96,20 @@ void mo5_video_init(unsigned char color);
  *       update_logic();
  *       draw();
  *   }
+ *
+ * Counts its polling iterations and reports them to mo5_frame.h
+ * (frame counter, idle time, overruns, raster bar).
  */
 void mo5_wait_vbl(void);
 
+/**
+ * Sets the screen border color (PRC bits 1-4).
+ * The VRAM bank selection (bit 0) is preserved.
+ *
+ * @param color  Border color (0..15, C_xxx constants)
+ */
+void mo5_set_border(unsigned char color);
+
 /**
  * Fills the entire screen (color and form banks) with the given color.
  *
@@ -1,59 +1,193 @@
 #!/usr/bin/env python3
 """
 Convertit une image disquette .fd (3.5" 720Ko) en .sd (5.25" 320Ko)
-pour Thomson MO5/TO7
+pour Thomson MO5/TO7, et inversement
 Basé sur le code C d'OlivierP-To8
 https://github.com/OlivierP-To8/InufutoPorts/blob/main/Thomson/fdtosd.c
+
+Un secteur .sd occupe 512 octets : les 256 octets du secteur suivis de
+256 octets de remplissage (0xFF). Un secteur absent du .fd est codé par
+512 octets à 0xFF ; à la reconversion en .fd, les faces finales vides
+sont retirées (une image makefd.py d'une face refait une image d'une face).
+
+La conversion lit et écrit piste par piste (4 Ko en mémoire), quelle que
+soit la taille de l'image, et calcule le CRC32 des données de chaque face :
+les CRC affichés pour le .fd et le .sd d'une même disquette sont égaux.
+
+Usage:
+    python3 fd2sd.py disk.fd disk.sd           # sens déduit des extensions
+    python3 fd2sd.py disk.sd disk.fd
+    python3 fd2sd.py disk.fd --track 20 track20.bin [--face 0]
+
+Usage (module, depuis makefd.py) :
+    import fd2sd
+    fd2sd.write_sd(io.BytesIO(image), sd_file)  # sans fichier .fd intermédiaire
 """
 
+import argparse
 import sys
 import os
+import zlib
 
-def fd_to_sd(fd_path, sd_path):
-    """Convertit un fichier .fd en .sd"""
-    
-    sector_buffer = bytearray(256)
-    empty = bytes([0xFF] * 512)
-    
+SECTOR_SIZE  = 256
+SD_SECTOR    = 2 * SECTOR_SIZE
+SECTORS      = 16
+TRACKS       = 80
+FACES        = 4
+TRACK_SIZE   = SECTORS * SECTOR_SIZE
+SD_TRACK     = SECTORS * SD_SECTOR
+EMPTY_SECTOR = bytes([0xFF] * SECTOR_SIZE)
+EMPTY_TRACK  = EMPTY_SECTOR * SECTORS
+
+
+def write_sd(fd, sd):
+    """
+    Convertit un flux .fd en flux .sd (objets fichier binaires).
+    Retourne la liste des CRC32 des faces présentes dans le .fd.
+    """
+    crcs = []
+    for track in range(FACES * TRACKS):
+        data = fd.read(TRACK_SIZE)
+        if track % TRACKS == 0 and data:
+            crcs.append(0)
+        if data:
+            crcs[-1] = zlib.crc32(data, crcs[-1])
+
+        # 16 secteurs par piste, secteur manquant = 0xFF
+        out = bytearray()
+        for sector in range(SECTORS):
+            chunk = data[sector * SECTOR_SIZE:(sector + 1) * SECTOR_SIZE]
+            if len(chunk) == SECTOR_SIZE:
+                out += chunk
+                out += EMPTY_SECTOR
+            else:
+                out += EMPTY_SECTOR * 2
+        sd.write(out)
+    return crcs
+
+
+def write_fd(sd, fd):
+    """
+    Convertit un flux .sd en flux .fd. Les pistes vides (0xFF) ne sont
+    écrites que si une piste de données les suit ; la sortie est complétée
+    à une face entière. Retourne la liste des CRC32 des faces écrites.
+    """
+    crcs = []
+    pending = 0         # pistes vides pas encore écrites
+    written = 0         # pistes écrites
+    for track in range(FACES * TRACKS):
+        raw = sd.read(SD_TRACK)
+        if not raw:
+            break
+        data = b''.join(raw[i:i + SECTOR_SIZE] for i in range(0, len(raw), SD_SECTOR))
+        data = data.ljust(TRACK_SIZE, b'\xff')
+        if data == EMPTY_TRACK:
+            pending += 1
+            continue
+        for _ in range(pending):
+            written = _put_track(fd, EMPTY_TRACK, written, crcs)
+        pending = 0
+        written = _put_track(fd, data, written, crcs)
+
+    while written % TRACKS:
+        written = _put_track(fd, EMPTY_TRACK, written, crcs)
+    return crcs
+
+
+def _put_track(fd, data, written, crcs):
+    if written % TRACKS == 0:
+        crcs.append(0)
+    crcs[-1] = zlib.crc32(data, crcs[-1])
+    fd.write(data)
+    return written + 1
+
+
+def read_track(path, track, face=0):
+    """Retourne les 16 secteurs (4096 octets) d'une piste d'une image .fd ou .sd."""
+    index = face * TRACKS + track
+    with open(path, 'rb') as f:
+        if path.lower().endswith('.sd'):
+            f.seek(index * SD_TRACK)
+            raw = f.read(SD_TRACK)
+            data = b''.join(raw[i:i + SECTOR_SIZE] for i in range(0, len(raw), SD_SECTOR))
+        else:
+            f.seek(index * TRACK_SIZE)
+            data = f.read(TRACK_SIZE)
+    if len(data) != TRACK_SIZE:
+        raise ValueError(f"piste {track} de la face {face} absente de {path}")
+    return data
+
+
+def convert(src_path, dst_path):
+    """Convertit .fd -> .sd ou .sd -> .fd selon les extensions. Retourne les CRC32."""
+    with open(src_path, 'rb') as src, open(dst_path, 'wb') as dst:
+        if src_path.lower().endswith('.sd'):
+            return write_fd(src, dst)
+        return write_sd(src, dst)
+
+
+def convert_file(src_path, dst_path):
+    """Convertit une image et affiche le CRC32 de chaque face."""
     try:
-        with open(fd_path, 'rb') as fd, open(sd_path, 'wb') as sd:
-            # 4 faces * 80 pistes = 320 pistes
-            for track in range(4 * 80):
-                # 16 secteurs par piste
-                for sector in range(1, 17):
-                    data = fd.read(256)
-                    if len(data) == 256:
-                        # Écrire le secteur + padding vide
-                        sd.write(data)
-                        sd.write(empty[:256])
-                    else:
-                        # Secteur manquant = remplir de 0xFF
-                        sd.write(empty)
-        
-        print(f"✓ Conversion réussie: {sd_path}")
+        crcs = convert(src_path, dst_path)
+        print(f"✓ Conversion réussie: {dst_path}")
+        report(crcs)
         return True
-        
+
     except FileNotFoundError:
-        print(f"✗ Erreur: impossible d'ouvrir {fd_path}")
+        print(f"✗ Erreur: impossible d'ouvrir {src_path}")
         return False
     except Exception as e:
         print(f"✗ Erreur lors de la conversion: {e}")
         return False
 
+
+def fd_to_sd(fd_path, sd_path):
+    """Convertit un fichier .fd en .sd"""
+    return convert_file(fd_path, sd_path)
+
+
+def report(crcs):
+    for face, crc in enumerate(crcs):
+        print(f"  face {face} : crc32 {crc:08x}")
+
+
 def main():
-    if len(sys.argv) != 4 or sys.argv[1] != '-conv':
-        print(f"Usage: {sys.argv[0]} -conv disk.fd disk.sd")
+    # Compatibilité : l'ancien drapeau -conv est accepté et ignoré
+    argv = [a for a in sys.argv[1:] if a != '-conv']
+
+    parser = argparse.ArgumentParser(description='Conversion .fd <-> .sd pour Thomson MO5/TO7')
+    parser.add_argument('input', help='Image .fd ou .sd')
+    parser.add_argument('output', nargs='?', help='Image convertie (.sd ou .fd)')
+    parser.add_argument('--track', nargs=2, metavar=('PISTE', 'SORTIE'),
+                        help='Extrait une piste brute (16 secteurs de 256 octets)')
+    parser.add_argument('--face', type=int, default=0, help='Face pour --track (défaut: 0)')
+    args = parser.parse_args(argv)
+
+    if not os.path.exists(args.input):
+        print(f"✗ Erreur: le fichier {args.input} n'existe pas")
         sys.exit(1)
-    
-    fd_path = sys.argv[2]
-    sd_path = sys.argv[3]
-    
-    if not os.path.exists(fd_path):
-        print(f"✗ Erreur: le fichier {fd_path} n'existe pas")
+
+    if args.track:
+        try:
+            data = read_track(args.input, int(args.track[0]), args.face)
+        except ValueError as e:
+            print(f"✗ Erreur: {e}")
+            sys.exit(1)
+        with open(args.track[1], 'wb') as f:
+            f.write(data)
+        print(f"✓ Piste {args.track[0]} (face {args.face}) écrite: {args.track[1]}")
+        if not args.output:
+            sys.exit(0)
+
+    if not args.output:
+        parser.error("image de sortie manquante")
+    if args.input.lower().endswith('.sd') == args.output.lower().endswith('.sd'):
+        print("✗ Erreur: convertir un .fd en .sd ou un .sd en .fd")
         sys.exit(1)
-    
-    success = fd_to_sd(fd_path, sd_path)
+
+    success = convert_file(args.input, args.output)
     sys.exit(0 if success else 1)
 
 if __name__ == '__main__':
-    main()
\ No newline at end of file
+    main()
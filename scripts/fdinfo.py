@@ -0,0 +1,392 @@
+#!/usr/bin/env python3
+"""
+fdinfo.py - Inspection et vérification d'une image disquette Thomson MO5
+
+Lit une image .fd (ou .sd) produite par makefd.py / fd2sd.py et :
+
+  - liste les fichiers du répertoire (taille, blocs, segments, date) ;
+  - vérifie le secteur de boot (somme de contrôle, signature BASIC2) et
+    les descripteurs du boot loader (piste 20, secteur 1) ;
+  - vérifie les chaînes FAT (boucle, bloc libre ou réservé dans une
+    chaîne, bloc partagé entre deux fichiers, bloc alloué orphelin) ;
+  - vérifie la table des overlays (piste 0, secteurs 2 à 8) ;
+  - indique l'espace libre et la fragmentation (segments par fichier,
+    retours en arrière de la tête pendant un chargement).
+
+Usage:
+    python3 fdinfo.py disk.fd                      # rapport complet
+    python3 fdinfo.py disk.fd --check              # erreurs seulement, code de sortie
+    python3 fdinfo.py disk.fd --extract GAME.BIN [-o game.bin]
+    python3 fdinfo.py disk.fd --extract-all out/
+    python3 fdinfo.py disk.sd --face 1             # face 1 d'une image .sd
+
+Code de sortie : 0 si l'image est valide, 1 sinon.
+"""
+
+import argparse
+import io
+import sys
+from pathlib import Path
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+sys.path.insert(0, str(SCRIPT_DIR))
+
+from makefd import (SECTOR_SIZE, SECTOR_BYTES, TRACK_SIZE, DISK_SIZE, BLOCK_SIZE,
+                    FAT_OFFSET, DIR_OFFSET, FREE_BLOCK, RESERVED_BLOCK,
+                    OVERLAY_TABLE_OFFSET, OVERLAY_TABLE_SIZE, SECTORS_PER_TRACK,
+                    interleave_order)
+import fd2sd
+
+NB_BLOCKS   = 160
+DIR_ENTRIES = 14 * SECTOR_SIZE // 32
+BOOT_TRACK  = 20 * TRACK_SIZE
+TYPES       = {0: "BASIC", 1: "DATA", 2: "BIN", 3: "TEXTE"}
+
+
+# ==============================================================================
+# Lecture de l'image
+# ==============================================================================
+def load_face(path, face=0):
+    """Retourne les 327680 octets d'une face (.fd, ou .sd reconstruit)."""
+    if Path(path).suffix.lower() == '.sd':
+        out = io.BytesIO()
+        with open(path, 'rb') as f:
+            fd2sd.write_fd(f, out)
+        raw = out.getvalue()
+    else:
+        raw = Path(path).read_bytes()
+    raw = raw[face * DISK_SIZE:(face + 1) * DISK_SIZE]
+    if len(raw) != DISK_SIZE:
+        raise ValueError(f"face {face} absente ou tronquée ({len(raw)} octets)")
+    return raw
+
+
+class DiskImage:
+    def __init__(self, data):
+        self.data   = data
+        self.errors = []
+        self.files  = []        # dict par entrée de répertoire
+        self.owner  = {}        # bloc -> nom du fichier
+
+    def error(self, msg):
+        self.errors.append(msg)
+
+    def fat(self, block):
+        return self.data[FAT_OFFSET + block]
+
+    # ------------------------------------------------------------------
+    def check_boot(self):
+        """Somme de contrôle du secteur de boot : 0x55 + somme des octets niés."""
+        d = self.data
+        checksum = 0x55
+        for i in range(127):
+            checksum = (checksum + (256 - d[i])) & 0xff
+        self.boot_ok = checksum == d[127]
+        self.boot_signature = bytes(d[120:126]) == b'BASIC2'
+        if not self.boot_ok:
+            self.error(f"secteur de boot : somme ${d[127]:02x}, attendue ${checksum:02x}")
+        if not self.boot_signature:
+            self.error("secteur de boot : signature BASIC2 absente")
+
+    def chain(self, name, block):
+        """
+        Suit la chaîne FAT d'un fichier. Retourne (blocs, secteurs du dernier
+        bloc) ; signale les chaînes invalides.
+        """
+        blocks = []
+        seen = set()
+        current = block
+        while True:
+            if current >= NB_BLOCKS:
+                self.error(f"{name} : bloc {current} hors disquette")
+                return blocks, 0
+            if current in seen:
+                self.error(f"{name} : boucle dans la chaîne FAT au bloc {current}")
+                return blocks, 0
+            seen.add(current)
+            blocks.append(current)
+
+            next_b = self.fat(current)
+            if next_b in (FREE_BLOCK, RESERVED_BLOCK):
+                kind = "libre" if next_b == FREE_BLOCK else "réservé"
+                self.error(f"{name} : le bloc {current} est marqué {kind} dans la FAT")
+                return blocks, 0
+            if next_b > 0xc0:
+                nbs = next_b - 0xc0
+                if nbs > 8:
+                    self.error(f"{name} : dernier bloc {current} de {nbs} secteurs")
+                return blocks, min(nbs, 8)
+            current = next_b
+
+    @staticmethod
+    def runs(blocks, last_sectors):
+        """Segments (piste, premier secteur, dernier secteur), contigus fusionnés."""
+        runs = []
+        for i, block in enumerate(blocks):
+            nbs = last_sectors if i == len(blocks) - 1 else 8
+            track  = block >> 1
+            sector = 9 if (block & 0x01) else 1
+            if runs and runs[-1][0] == track and runs[-1][2] + 1 == sector:
+                runs[-1] = (track, runs[-1][1], sector + nbs - 1)
+            else:
+                runs.append((track, sector, sector + nbs - 1))
+        return runs
+
+    def check_directory(self):
+        d = self.data
+        for index in range(DIR_ENTRIES):
+            entry = DIR_OFFSET + index * 32
+            if d[entry] in (0x00, FREE_BLOCK):
+                continue
+            name = bytes(d[entry:entry + 8]).decode('latin-1').rstrip()
+            ext  = bytes(d[entry + 8:entry + 11]).decode('latin-1').rstrip()
+            full = f"{name}.{ext}" if ext else name
+            first = d[entry + 13]
+            size_left = (d[entry + 14] << 8) | d[entry + 15]
+
+            blocks, nbs = self.chain(full, first)
+            if nbs and not 1 <= size_left <= SECTOR_BYTES:
+                self.error(f"{full} : {size_left} octets dans le dernier secteur")
+            size = 0
+            if nbs:
+                size = ((len(blocks) - 1) * 8 + nbs - 1) * SECTOR_BYTES + size_left
+
+            for block in blocks:
+                if block in self.owner:
+                    self.error(f"{full} : bloc {block} partagé avec {self.owner[block]}")
+                else:
+                    self.owner[block] = full
+
+            runs = self.runs(blocks, nbs) if nbs else []
+            backward = sum(1 for a, b in zip(runs, runs[1:]) if b[0] < a[0])
+            self.files.append({
+                'index': index, 'name': full, 'type': TYPES.get(d[entry + 11], "?"),
+                'first': first, 'blocks': blocks, 'sectors': nbs, 'size': size,
+                'runs': runs, 'backward': backward,
+                'date': (d[entry + 24], d[entry + 25], d[entry + 26]),
+            })
+
+    def check_fat(self):
+        """Blocs alloués dans la FAT mais n'appartenant à aucun fichier."""
+        for block in range(NB_BLOCKS):
+            value = self.fat(block)
+            if value in (FREE_BLOCK, RESERVED_BLOCK) or block in self.owner:
+                continue
+            self.error(f"bloc {block} alloué (FAT ${value:02x}) mais hors de tout fichier")
+
+    # ------------------------------------------------------------------
+    def read_file(self, f):
+        """Contenu d'un fichier, en suivant sa chaîne FAT."""
+        out = bytearray()
+        for i, block in enumerate(f['blocks']):
+            nbs = f['sectors'] if i == len(f['blocks']) - 1 else 8
+            for s in range(nbs):
+                start = block * BLOCK_SIZE + s * SECTOR_SIZE
+                out += self.data[start:start + SECTOR_BYTES]
+        return bytes(out[:f['size']])
+
+    def check_boot_loader(self):
+        """Descripteurs du boot loader : doivent suivre les premiers fichiers."""
+        d = self.data
+        self.boot_files = []
+        n = BOOT_TRACK + 12
+        for index in range(DIR_ENTRIES):
+            if (d[n] << 8 | d[n + 1]) == 0xffff or n >= BOOT_TRACK + SECTOR_SIZE - 5:
+                break
+            addr = d[n] << 8 | d[n + 1]
+            n += 2
+            runs = []
+            while d[n] != FREE_BLOCK and n < BOOT_TRACK + SECTOR_SIZE - 3:
+                runs.append((d[n], d[n + 1], d[n + 2]))
+                n += 3
+            exec_addr = d[n + 1] << 8 | d[n + 2]
+            n += 3
+            self.boot_files.append((addr, runs, exec_addr))
+
+            f = next((f for f in self.files if f['index'] == index), None)
+            if f is None:
+                self.error(f"boot loader : fichier #{index} absent du répertoire")
+                continue
+            expected = [(b >> 1, 9 if b & 1 else 1,
+                         (9 if b & 1 else 1) + (f['sectors'] if i == len(f['blocks']) - 1 else 8) - 1)
+                        for i, b in enumerate(f['blocks'])]
+            if runs != expected:
+                self.error(f"boot loader : les segments de {f['name']} ne suivent pas sa chaîne FAT")
+
+    def check_overlays(self):
+        """Table des overlays de makefd.py --overlay (si présente)."""
+        d = self.data
+        self.overlays = []
+        self.interleave = None
+        table = d[OVERLAY_TABLE_OFFSET:OVERLAY_TABLE_OFFSET + OVERLAY_TABLE_SIZE]
+        if self.fat(0) != RESERVED_BLOCK or not 1 <= table[0] < SECTORS_PER_TRACK:
+            return
+        # Le premier nom doit être de l'ASCII imprimable, ou la table vide
+        if table[1] != FREE_BLOCK and not all(0x20 <= c < 0x7f for c in table[1:12]):
+            return
+
+        self.interleave = table[0]
+        order = interleave_order(self.interleave)
+        pos = 1
+        while pos < len(table) and table[pos] != FREE_BLOCK:
+            if pos + 14 > len(table):
+                self.error("overlays : table tronquée")
+                return
+            name = bytes(table[pos:pos + 8]).decode('latin-1').rstrip()
+            ext  = bytes(table[pos + 8:pos + 11]).decode('latin-1').rstrip()
+            full = f"{name}.{ext}" if ext else name
+            size = table[pos + 11] << 8 | table[pos + 12]
+            count = table[pos + 13]
+            pos += 14
+            runs = [tuple(table[pos + 3 * i:pos + 3 * i + 3]) for i in range(count)]
+            pos += 3 * count
+            self.overlays.append((full, size, runs))
+
+            capacity = sum(last - first + 1 for _, first, last in runs) * SECTOR_BYTES
+            if capacity < size:
+                self.error(f"overlay {full} : {capacity} octets de segments pour {size} octets")
+            f = next((f for f in self.files if f['name'] == full), None)
+            if f is None:
+                self.error(f"overlay {full} : absent du répertoire")
+                continue
+            for track, first, last in runs:
+                for p in range(first, last + 1):
+                    if not 1 <= p <= SECTORS_PER_TRACK or track >= NB_BLOCKS // 2:
+                        self.error(f"overlay {full} : segment ({track}, {first}, {last}) invalide")
+                        break
+                    block = track * 2 + (1 if order[p - 1] > 8 else 0)
+                    if block not in f['blocks']:
+                        self.error(f"overlay {full} : piste {track} hors de ses blocs")
+                        break
+
+    def read_overlay(self, size, runs):
+        """Contenu d'un overlay, dans l'ordre d'entrelacement de la table."""
+        order = interleave_order(self.interleave)
+        out = bytearray()
+        for track, first, last in runs:
+            for p in range(first, last + 1):
+                start = track * TRACK_SIZE + (order[p - 1] - 1) * SECTOR_SIZE
+                out += self.data[start:start + SECTOR_BYTES]
+        return bytes(out[:size])
+
+    # ------------------------------------------------------------------
+    def free_space(self):
+        """Retourne (blocs libres, plus longue suite de blocs libres contigus)."""
+        free = [b for b in range(NB_BLOCKS) if self.fat(b) == FREE_BLOCK]
+        longest = run = 0
+        prev = None
+        for b in free:
+            run = run + 1 if prev is not None and b == prev + 1 else 1
+            longest = max(longest, run)
+            prev = b
+        return len(free), longest
+
+    def inspect(self):
+        self.check_boot()
+        self.check_directory()
+        self.check_fat()
+        self.check_boot_loader()
+        self.check_overlays()
+
+
+# ==============================================================================
+# Rapport
+# ==============================================================================
+def report(disk):
+    d = disk.data
+    label = bytes(d[BOOT_TRACK:BOOT_TRACK + 8]).decode('latin-1').rstrip()
+    print(f"=== Disquette '{label}' ===")
+    print(f"Boot : somme {'OK' if disk.boot_ok else 'INVALIDE'}, "
+          f"signature {'BASIC2' if disk.boot_signature else 'absente'}")
+
+    print("")
+    print(f"{'#':>2} {'Fichier':<12} {'Type':<6} {'Octets':>6} {'Blocs':>5} {'Seg.':>4} {'Recul':>5}  Date")
+    for f in disk.files:
+        day, month, year = f['date']
+        print(f"{f['index']:>2} {f['name']:<12} {f['type']:<6} {f['size']:>6} "
+              f"{len(f['blocks']):>5} {len(f['runs']):>4} {f['backward']:>5}  "
+              f"{day:02}/{month:02}/{2000 + year}")
+        if len(f['runs']) > 1:
+            print("   " + " ".join(f"{t}:{a}-{b}" for t, a, b in f['runs']))
+
+    if disk.boot_files:
+        print("")
+        print("Boot loader :")
+        for i, (addr, runs, exec_addr) in enumerate(disk.boot_files):
+            print(f"  #{i} chargé en ${addr:04x}, exécuté en ${exec_addr:04x}, {len(runs)} segment(s)")
+
+    if disk.interleave is not None:
+        print("")
+        print(f"Overlays (entrelacement {disk.interleave}) :")
+        for name, size, runs in disk.overlays:
+            print(f"  {name:<12} {size:>6} octets, {len(runs)} segment(s)")
+
+    free, longest = disk.free_space()
+    used = [f for f in disk.files if f['blocks']]
+    fragmented = sum(1 for f in used if len(f['runs']) > 1)
+    print("")
+    print(f"Libre : {free} blocs ({free * 8 * SECTOR_BYTES} octets), "
+          f"plus grande zone contiguë {longest} blocs")
+    print(f"Fragmentation : {fragmented}/{len(used)} fichier(s) en plusieurs segments, "
+          f"{sum(f['backward'] for f in used)} retour(s) de tête en arrière")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Inspection et vérification d\'une image disquette MO5')
+    parser.add_argument('image', help='Image .fd ou .sd')
+    parser.add_argument('--face', type=int, default=0, help='Face à inspecter (défaut: 0)')
+    parser.add_argument('--check', action='store_true', help='N\'affiche que les erreurs')
+    parser.add_argument('--extract', metavar='NOM', help='Extrait un fichier (NOM.EXT)')
+    parser.add_argument('-o', '--output', help='Fichier de sortie pour --extract (défaut: NOM.EXT)')
+    parser.add_argument('--extract-all', metavar='DIR', help='Extrait tous les fichiers dans DIR')
+    args = parser.parse_args()
+
+    try:
+        disk = DiskImage(load_face(args.image, args.face))
+    except (OSError, ValueError) as e:
+        print(f"[ERREUR] {args.image}: {e}")
+        sys.exit(1)
+    disk.inspect()
+
+    if not args.check:
+        report(disk)
+
+    if args.extract:
+        wanted = args.extract.upper()
+        overlay = next((o for o in disk.overlays if o[0] == wanted), None)
+        f = next((f for f in disk.files if f['name'] == wanted), None)
+        if f is None:
+            print(f"[ERREUR] {args.extract} absent de la disquette")
+            sys.exit(1)
+        # Un overlay entrelacé se lit dans l'ordre de la table, pas de la FAT
+        if overlay and disk.interleave > 1:
+            content = disk.read_overlay(overlay[1], overlay[2])
+        else:
+            content = disk.read_file(f)
+        out = Path(args.output or f['name'])
+        out.write_bytes(content)
+        print(f"[OK] {f['name']} -> {out} ({len(content)} octets)")
+
+    if args.extract_all:
+        out_dir = Path(args.extract_all)
+        out_dir.mkdir(parents=True, exist_ok=True)
+        overlays = {o[0]: o for o in disk.overlays}
+        for f in disk.files:
+            overlay = overlays.get(f['name'])
+            if overlay and disk.interleave > 1:
+                content = disk.read_overlay(overlay[1], overlay[2])
+            else:
+                content = disk.read_file(f)
+            (out_dir / f['name']).write_bytes(content)
+        print(f"[OK] {len(disk.files)} fichier(s) extrait(s) dans {out_dir}")
+
+    if disk.errors:
+        for msg in disk.errors:
+            print(f"[ERREUR] {msg}")
+        sys.exit(1)
+    if args.check:
+        print(f"[OK] {args.image} : image valide")
+
+
+if __name__ == '__main__':
+    main()
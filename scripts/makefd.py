@@ -4,12 +4,29 @@ makefd.py - Génère une image disquette .fd bootable pour Thomson MO5
 Remplace : fdfs -addBL output.fd BOOTMO.BIN program.BIN
 
 Usage:
-    python3 makefd.py output.fd program.BIN [file2.BIN ...]
+    python3 makefd.py output.fd program.BIN [file2.BIN ...] [--overlay level1.DAT ...] [--interleave K]
+                      [--sd output.sd]
+
+Avec --sd, l'image .sd (SDDrive) est écrite en même temps, directement
+depuis la mémoire (fd2sd.write_sd), sans relire le .fd.
+
+Les fichiers --overlay ne sont pas chargés au boot : ils sont décrits dans
+une table d'overlays (piste 0, secteurs 2 à 8) que le jeu lit avec
+mo5_disk.h pour charger un fichier à la demande, à l'adresse de son choix.
+
+Avec --interleave K (K > 1), chaque overlay occupe des pistes entières
+(au moins 4 Ko, même pour un petit fichier), en ordre croissant, et ses secteurs consécutifs sont espacés de K secteurs sur
+la piste : le chargeur, qui lit dans ce même ordre, trouve le secteur
+suivant sous la tête au lieu d'attendre un tour complet. Ces overlays ne
+sont lisibles que par mo5_disk.h (le DOS verrait leur contenu dans le
+désordre).
 
 Basé sur fdfs.c d'OlivierP-To8 (https://github.com/OlivierP-To8/BootFloppyDisk)
 Le binaire BOOTMO.BIN est embarqué directement dans ce script.
 """
 
+import argparse
+import io
 import sys
 import struct
 import os
@@ -33,6 +50,35 @@ DIR_OFFSET = 20 * TRACK_SIZE + 2 * SECTOR_SIZE   # secteur 3 de la piste 20
 FREE_BLOCK     = 0xff
 RESERVED_BLOCK = 0xfe
 
+# Table des overlays : secteurs 2 à 8 de la piste 0 (bloc 0, réservé au boot)
+# En-tête : entrelacement (1). Entrée : nom (8) + extension (3), taille (2,
+# big-endian), nombre de segments (1), puis segments (piste, première
+# position, dernière position) ; les positions 1 à 16 désignent les secteurs
+# dans l'ordre d'entrelacement (secteur = position avec un entrelacement 1).
+# Fin de table : 0xff. Format lu par src/mo5_disk.c.
+OVERLAY_TABLE_OFFSET = SECTOR_SIZE
+OVERLAY_TABLE_SIZE   = 7 * SECTOR_SIZE
+OVERLAY_MAX_RUNS     = 24                 # MO5_DISK_MAX_RUNS
+SECTORS_PER_TRACK    = 16
+
+
+def interleave_order(k: int) -> list:
+    """
+    Ordre de lecture des 16 secteurs d'une piste avec un entrelacement k :
+    1, 1+k, 1+2k... (modulo 16, en sautant les secteurs déjà pris).
+    Même calcul que disk_order() dans src/mo5_disk.c.
+    """
+    used = [False] * SECTORS_PER_TRACK
+    order = []
+    pos = 0
+    for _ in range(SECTORS_PER_TRACK):
+        while used[pos]:
+            pos = (pos + 1) % SECTORS_PER_TRACK
+        used[pos] = True
+        order.append(pos + 1)
+        pos = (pos + k) % SECTORS_PER_TRACK
+    return order
+
 # ==============================================================================
 # BOOTMO.BIN embarqué (compilé depuis BootMO.asm d'OlivierP-To8)
 # Chargeur de boot pour Thomson MO5, max 120 octets utiles
@@ -89,6 +135,8 @@ BOOTMO_BIN = bytes([
 class FloppyDisk:
     def __init__(self):
         self.data = bytearray(DISK_SIZE)
+        self.overlays = []      # (nom 8.3, taille, premier bloc, segments ou None)
+        self.interleave = 1
 
     def format(self, diskname: str = None):
         """Formate la disquette (équivalent de formatDisk dans fdfs.c)."""
@@ -111,6 +159,9 @@ class FloppyDisk:
         # Le 1er octet du secteur FAT n'est pas utilisé
         self.data[FAT_OFFSET - 1] = 0x00
 
+        # Bloc 0 réservé : secteur de boot et table des overlays
+        self.data[FAT_OFFSET] = RESERVED_BLOCK
+
         # Piste 20 réservée (2 blocs)
         self.data[FAT_OFFSET + 2 * 20]     = RESERVED_BLOCK
         self.data[FAT_OFFSET + 2 * 20 + 1] = RESERVED_BLOCK
@@ -207,8 +258,11 @@ class FloppyDisk:
                 for j in range(nb, SECTOR_SIZE):
                     self.data[dst + j] = 0x00
 
-    def add_file_content(self, filename: str, file_bytes: bytes):
-        """Alloue des blocs et écrit le contenu d'un fichier sur la disquette."""
+    def add_file_content(self, filename: str, file_bytes: bytes) -> int:
+        """
+        Alloue des blocs et écrit le contenu d'un fichier sur la disquette.
+        Retourne le premier bloc du fichier.
+        """
         size = len(file_bytes)
         blocks = []
         offset = 0
@@ -240,6 +294,8 @@ class FloppyDisk:
 
             size_left -= BLOCK_BYTES
 
+        return blocks[0]
+
     def add_file(self, filepath: str):
         """
         Charge un fichier .BIN et l'ajoute à la disquette.
@@ -270,6 +326,131 @@ class FloppyDisk:
         print(f"  Ajout de {filename} ({size} octets)")
         self.add_file_content(filename, bytes(file_bytes))
 
+    def add_overlay(self, filepath: str):
+        """
+        Ajoute un fichier chargé à la demande (niveau, données) : il est
+        écrit comme un fichier normal, mais pas chargé au boot, et décrit
+        dans la table des overlays par write_overlay_table().
+        """
+        filename = os.path.basename(filepath).upper()
+        with open(filepath, 'rb') as f:
+            raw = f.read()
+        if not raw:
+            raise ValueError(f"Overlay vide : {filename}")
+
+        print(f"  Ajout de l'overlay {filename} ({len(raw)} octets)")
+        if self.interleave > 1:
+            block, runs = self._add_interleaved(filename, raw)
+        else:
+            block, runs = self.add_file_content(filename, raw), None
+        self.overlays.append((filename, len(raw), block, runs))
+
+    def _find_free_track(self, taken: list) -> int:
+        """Première piste dont les 2 blocs sont libres (pistes 0 et 20 exclues)."""
+        for track in range(1, 80):
+            if (track != 20 and track not in taken
+                    and self.data[FAT_OFFSET + 2 * track] == FREE_BLOCK
+                    and self.data[FAT_OFFSET + 2 * track + 1] == FREE_BLOCK):
+                return track
+        raise ValueError("Disquette pleine (plus de piste entière libre)")
+
+    def _add_interleaved(self, filename: str, file_bytes: bytes):
+        """
+        Écrit un overlay sur des pistes entières, par ordre croissant, en
+        plaçant ses secteurs dans l'ordre d'entrelacement. Retourne
+        (premier bloc, segments).
+        """
+        order = interleave_order(self.interleave)
+        size = len(file_bytes)
+        nb_chunks = (size + SECTOR_BYTES - 1) // SECTOR_BYTES
+
+        tracks = []
+        runs = []
+        chunk = 0
+        while chunk < nb_chunks:
+            track = self._find_free_track(tracks)
+            count = min(SECTORS_PER_TRACK, nb_chunks - chunk)
+            for pos in range(count):
+                src = (chunk + pos) * SECTOR_BYTES
+                dst = track * TRACK_SIZE + (order[pos] - 1) * SECTOR_SIZE
+                part = file_bytes[src:src + SECTOR_BYTES]
+                self.data[dst:dst + SECTOR_SIZE] = part + bytes(SECTOR_SIZE - len(part))
+            tracks.append(track)
+            runs.append((track, 1, count))
+            chunk += count
+
+        # Chaîne FAT : pistes entières. Le dernier bloc s'arrête au dernier
+        # secteur physique occupé, qui ne porte pas forcément le dernier
+        # morceau du fichier : son nombre d'octets est celui qu'il contient.
+        blocks = []
+        for track in tracks:
+            blocks.extend((2 * track, 2 * track + 1))
+        last_count  = runs[-1][2]
+        last_sector = max(order[:last_count])
+        if last_sector <= 8:
+            blocks.pop()
+        for a, b in zip(blocks, blocks[1:]):
+            self.data[FAT_OFFSET + a] = b
+        self.data[FAT_OFFSET + blocks[-1]] = 0xc0 + (last_sector - 1) % 8 + 1
+        last_chunk = nb_chunks - last_count + order.index(last_sector)
+        last_bytes = min(SECTOR_BYTES, size - last_chunk * SECTOR_BYTES)
+        self._add_file_entry(filename, blocks[0], last_bytes)
+
+        return blocks[0], runs
+
+    def _file_runs(self, block: int) -> list:
+        """
+        Suit la chaîne FAT d'un fichier et retourne ses segments
+        (piste, premier secteur, dernier secteur), contigus fusionnés.
+        """
+        runs = []
+        current = block
+        while current != FREE_BLOCK:
+            next_b = self.data[FAT_OFFSET + current]
+            nbs = 8
+            if next_b > 0xc0:
+                nbs = next_b - 0xc0
+                next_b = FREE_BLOCK
+
+            track  = current >> 1
+            sector = 9 if (current & 0x01) else 1
+            if runs and runs[-1][0] == track and runs[-1][2] + 1 == sector:
+                runs[-1] = (track, runs[-1][1], sector + nbs - 1)
+            else:
+                runs.append((track, sector, sector + nbs - 1))
+
+            current = next_b
+        return runs
+
+    def write_overlay_table(self):
+        """Écrit la table des overlays dans les secteurs 2 à 8 de la piste 0."""
+        table = bytearray([self.interleave])
+        for filename, size, block, runs in self.overlays:
+            name = Path(filename).stem[:8].ljust(8)
+            ext  = Path(filename).suffix.lstrip('.')[:3].ljust(3)
+            if runs is None:
+                runs = self._file_runs(block)
+            if len(runs) > OVERLAY_MAX_RUNS:
+                raise ValueError(f"Overlay {filename} trop fragmenté ({len(runs)} segments, "
+                                 f"max {OVERLAY_MAX_RUNS})")
+
+            table.extend((name + ext).encode('ascii'))
+            table.append((size >> 8) & 0xff)
+            table.append(size & 0xff)
+            table.append(len(runs))
+            for run in runs:
+                table.extend(run)
+            print(f"  Overlay {filename}: {size} octets, {len(runs)} segment(s)")
+
+        table.append(FREE_BLOCK)
+        if len(table) > OVERLAY_TABLE_SIZE:
+            raise ValueError(f"Table des overlays trop grande ({len(table)} octets, "
+                             f"max {OVERLAY_TABLE_SIZE})")
+
+        self.data[FAT_OFFSET] = RESERVED_BLOCK
+        start = OVERLAY_TABLE_OFFSET
+        self.data[start:start + len(table)] = table
+
     # ------------------------------------------------------------------
     def add_boot_loader(self, nb_files: int):
         """
@@ -372,21 +553,40 @@ class FloppyDisk:
             f.write(self.data)
         print(f"✓ Image .fd écrite : {path} ({DISK_SIZE} octets)")
 
+    def save_sd(self, path: str):
+        """Écrit l'image au format .sd (SDDrive) avec le convertisseur de fd2sd.py."""
+        sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+        import fd2sd
+
+        with open(path, 'wb') as f:
+            crcs = fd2sd.write_sd(io.BytesIO(self.data), f)
+        print(f"✓ Image .sd écrite : {path} (crc32 {crcs[0]:08x})")
+
 
 # ==============================================================================
 # Point d'entrée
 # ==============================================================================
 def main():
     if len(sys.argv) < 3:
-        print("Usage: python3 makefd.py output.fd program.BIN [file2.BIN ...]")
+        print("Usage: python3 makefd.py output.fd program.BIN [file2.BIN ...] [--overlay data.DAT ...]")
         print("")
         print("  Génère une image disquette .fd bootable pour Thomson MO5.")
         print("  Remplace : fdfs -addBL output.fd BOOTMO.BIN program.BIN")
         print("  Le boot loader MO5 est embarqué dans ce script.")
+        print("  Les fichiers --overlay sont chargés à la demande par mo5_disk.h.")
+        print("  --sd output.sd écrit aussi l'image SDDrive.")
         sys.exit(1)
 
-    output_fd  = sys.argv[1]
-    input_bins = sys.argv[2:]
+    parser = argparse.ArgumentParser(add_help=False)
+    parser.add_argument('output_fd')
+    parser.add_argument('input_bins', nargs='+')
+    parser.add_argument('--overlay', nargs='+', default=[])
+    parser.add_argument('--interleave', type=int, default=1, choices=range(1, SECTORS_PER_TRACK))
+    parser.add_argument('--sd')
+    args = parser.parse_args()
+
+    output_fd  = args.output_fd
+    input_bins = args.input_bins
 
     print(f"=== Génération de {output_fd} ===")
     disk = FloppyDisk()
@@ -396,11 +596,23 @@ def main():
     for bin_path in input_bins:
         disk.add_file(bin_path)
 
+    disk.interleave = args.interleave
+    if args.overlay:
+        print("--- Ajout des overlays ---")
+        for path in args.overlay:
+            disk.add_overlay(path)
+        disk.write_overlay_table()
+
+    # Les overlays sont ajoutés après les programmes : le boot loader
+    # ne décrit que les len(input_bins) premières entrées du répertoire
     print("--- Écriture du boot loader MO5 ---")
     disk.add_boot_loader(len(input_bins))
 
     os.makedirs(os.path.dirname(os.path.abspath(output_fd)), exist_ok=True)
     disk.save(output_fd)
+    if args.sd:
+        os.makedirs(os.path.dirname(os.path.abspath(args.sd)), exist_ok=True)
+        disk.save_sd(args.sd)
 
 
 if __name__ == '__main__':
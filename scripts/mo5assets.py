@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+"""
+mo5assets.py - Conversion par lot des assets PNG pour le Thomson MO5
+
+Lit un manifeste (une image par ligne, suivie de ses options png2mo5.py),
+convertit les images en parallèle sur tous les cœurs, et ne reconvertit
+que les images modifiées (cache par empreinte de contenu). Génère un index
+unique qui inclut tous les headers.
+
+Manifeste (chemins relatifs au répertoire courant) :
+
+    # commentaire
+    assets/hero.png     --sheet 16x24 --transparent
+    assets/title.png    --screen
+    assets/intro1.png   --screen --delta-from assets/title.png
+    assets/boss.png     --compress --name boss_big
+
+Sans --name, le header est <sortie>/<nom de l'image>.h ; --name ne donne
+que le nom (le répertoire de sortie est toujours celui de la ligne de
+commande).
+
+Une image est reconvertie si son contenu, ses options, l'image de
+--delta-from ou les scripts de conversion ont changé, ou si son header
+n'existe plus.
+
+Usage:
+    python3 mo5assets.py assets/assets.txt include/assets [-j 4] [--index assets.h] [--force]
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import shlex
+import sys
+from concurrent.futures import ProcessPoolExecutor
+from pathlib import Path
+
+CACHE_FILE = ".mo5assets_cache.json"
+SCRIPT_DIR = Path(__file__).resolve().parent
+TOOL_FILES = ("png2mo5.py", "mo5lz.py", "mo5screen.py")
+
+
+def tool_hash():
+    """Empreinte des scripts de conversion : un changement invalide tout le cache."""
+    h = hashlib.sha256()
+    for name in TOOL_FILES:
+        h.update((SCRIPT_DIR / name).read_bytes())
+    return h.hexdigest()
+
+
+def read_manifest(path, out_dir):
+    """
+    Lit le manifeste. Retourne une liste de (ligne, image, options, header).
+    Lève ValueError sur une ligne invalide.
+    """
+    entries = []
+    headers = set()
+    with open(path, encoding='utf-8') as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            tokens = shlex.split(line)
+            image, options = tokens[0], tokens[1:]
+
+            name = Path(image).stem
+            if '--name' in options:
+                i = options.index('--name')
+                if i + 1 >= len(options):
+                    raise ValueError(f"{path}:{lineno}: --name sans valeur")
+                name = Path(options[i + 1]).stem
+                del options[i:i + 2]
+            header = out_dir / f"{name}.h"
+            if header in headers:
+                raise ValueError(f"{path}:{lineno}: header {header} produit deux fois")
+            headers.add(header)
+
+            entries.append((lineno, image, options, header))
+    return entries
+
+
+def entry_hash(tools, image, options):
+    """Empreinte d'une conversion : scripts + options + contenu des images utilisées."""
+    h = hashlib.sha256()
+    h.update(tools.encode())
+    h.update("\0".join(options).encode())
+    h.update(Path(image).read_bytes())
+    if '--delta-from' in options:
+        i = options.index('--delta-from')
+        if i + 1 < len(options):
+            h.update(Path(options[i + 1]).read_bytes())
+    return h.hexdigest()
+
+
+def build_asset(job):
+    """Convertit une image (exécuté dans un processus de travail)."""
+    image, options, header = job
+
+    sys.path.insert(0, str(SCRIPT_DIR))
+    import png2mo5
+
+    try:
+        args = png2mo5.parse_args([image, '--name', str(header), '--quiet'] + options)
+    except SystemExit:
+        return header, None, f"options invalides: {' '.join(options)}"
+
+    result = png2mo5.convert_from_args(args)
+    if result is None:
+        return header, None, "échec de la conversion"
+
+    with open(header, 'w', encoding='utf-8') as f:
+        f.write(result['Code'])
+
+    size = result['PackedSize'] or 2 * result['BytesPerLine'] * result['Height']
+    return header, size, None
+
+
+def write_index(path, headers, sizes):
+    """Écrit l'index des assets (seulement s'il change, pour ne pas relancer make)."""
+    guard = 'MO5_' + ''.join(c if c.isalnum() else '_' for c in path.name).upper()
+    lines = [
+        "// Généré par mo5assets.py - ne pas modifier",
+        "// Les headers d'assets définissent leurs tableaux : inclure cet index",
+        "// dans un seul fichier .c du jeu.",
+        "",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+    ]
+    for header in headers:
+        lines.append(f'#include "{header.name}"'.ljust(40) + f"// {sizes[header]} octets")
+    lines.append("")
+    lines.append(f"#define MO5_ASSETS_COUNT {len(headers)}")
+    lines.append(f"#define MO5_ASSETS_BYTES {sum(sizes[h] for h in headers)}")
+    lines.append("")
+    lines.append(f"#endif // {guard}")
+    text = "\n".join(lines) + "\n"
+
+    if path.exists() and path.read_text(encoding='utf-8') == text:
+        return False
+    path.write_text(text, encoding='utf-8')
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Conversion par lot des assets PNG pour le Thomson MO5')
+    parser.add_argument('manifest', help='Manifeste des assets (une image + options par ligne)')
+    parser.add_argument('out_dir', help='Répertoire des headers générés')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count() or 1,
+                        help='Nombre de conversions en parallèle (défaut: nombre de cœurs)')
+    parser.add_argument('--index', default='assets.h',
+                        help="Nom de l'index généré dans le répertoire de sortie (défaut: assets.h)")
+    parser.add_argument('--force', action='store_true', help='Ignore le cache et reconvertit tout')
+    args = parser.parse_args()
+
+    out_dir = Path(args.out_dir)
+    out_dir.mkdir(parents=True, exist_ok=True)
+
+    try:
+        entries = read_manifest(args.manifest, out_dir)
+    except (OSError, ValueError) as e:
+        print(f"[ERREUR] {e}")
+        sys.exit(1)
+
+    cache_path = out_dir / CACHE_FILE
+    cache = {}
+    if cache_path.exists() and not args.force:
+        try:
+            cache = json.loads(cache_path.read_text(encoding='utf-8'))
+        except ValueError:
+            cache = {}
+
+    tools = tool_hash()
+    jobs = []
+    hashes = {}
+    sizes = {}
+    for lineno, image, options, header in entries:
+        try:
+            digest = entry_hash(tools, image, options)
+        except OSError as e:
+            print(f"[ERREUR] {args.manifest}:{lineno}: {e}")
+            sys.exit(1)
+        hashes[header] = digest
+        cached = cache.get(header.name)
+        if cached and cached['hash'] == digest and header.exists():
+            sizes[header] = cached['size']
+        else:
+            jobs.append((image, options, header))
+
+    errors = 0
+    if jobs:
+        print(f"[INFO] {len(jobs)} asset(s) à convertir sur {len(entries)}, {args.jobs} en parallèle")
+        with ProcessPoolExecutor(max_workers=max(1, args.jobs)) as pool:
+            for header, size, error in pool.map(build_asset, jobs):
+                if error:
+                    print(f"[ERREUR] {header}: {error}")
+                    errors += 1
+                    continue
+                print(f"[OK] {header} ({size} octets)")
+                sizes[header] = size
+                cache[header.name] = {'hash': hashes[header], 'size': size}
+    else:
+        print(f"[OK] {len(entries)} asset(s) à jour")
+
+    # Les entrées retirées du manifeste sortent du cache
+    names = {header.name for _, _, _, header in entries}
+    cache = {k: v for k, v in cache.items() if k in names}
+    cache_path.write_text(json.dumps(cache, indent=1, sort_keys=True), encoding='utf-8')
+
+    if errors:
+        print(f"[ERREUR] {errors} conversion(s) en échec, index non mis à jour")
+        sys.exit(1)
+
+    headers = [header for _, _, _, header in entries]
+    index = out_dir / args.index
+    if write_index(index, headers, sizes):
+        print(f"[OK] Index généré: {index} ({sum(sizes.values())} octets de données)")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+mo5lz.py - Compression LZ orientée octet pour le Thomson MO5
+
+Format pensé pour un décodage rapide en 6809 (voir src/mo5_lz.c) :
+pas de bits à extraire, seulement des octets de contrôle.
+
+    en-tête : 2 octets, taille décompressée (big-endian)
+    0nnnnnnn               : nnnnnnn+1 littéraux suivent (1..128)
+    1nnnnnnn hi lo         : copie de nnnnnnn+3 octets (3..130)
+                             depuis sortie - (hi:lo)   (1..65535)
+
+Une copie peut chevaucher sa source (offset < longueur) : c'est ainsi
+qu'une répétition d'octets (RLE) est encodée.
+
+Usage (module) :
+    import mo5lz
+    packed = mo5lz.compress(data)
+    assert mo5lz.decompress(packed) == data
+
+Usage (ligne de commande) :
+    python3 mo5lz.py input.bin output.lz
+"""
+
+import sys
+
+MIN_MATCH   = 3
+MAX_MATCH   = 127 + MIN_MATCH
+MAX_LITERAL = 128
+MAX_OFFSET  = 0xFFFF
+MAX_CHAIN   = 64        # positions examinées par préfixe (compromis vitesse/taux)
+
+
+def _flush_literals(out, data, start, end):
+    """Émet data[start:end] en blocs de 128 littéraux maximum."""
+    while start < end:
+        n = min(MAX_LITERAL, end - start)
+        out.append(n - 1)
+        out.extend(data[start:start + n])
+        start += n
+
+
+def compress(data):
+    """Compresse des octets au format MO5 LZ. Retourne un bytes."""
+    data = bytes(data)
+    size = len(data)
+    if size > 0xFFFF:
+        raise ValueError(f"Données trop grandes pour le format MO5 LZ ({size} octets)")
+
+    out = bytearray([(size >> 8) & 0xFF, size & 0xFF])
+    chains = {}          # préfixe 3 octets -> positions récentes
+    lit_start = 0
+    pos = 0
+
+    def index(p):
+        if p + MIN_MATCH <= size:
+            key = data[p:p + MIN_MATCH]
+            chain = chains.setdefault(key, [])
+            chain.append(p)
+            if len(chain) > MAX_CHAIN:
+                del chain[0]
+
+    while pos < size:
+        best_len = 0
+        best_off = 0
+        if pos + MIN_MATCH <= size:
+            limit = min(MAX_MATCH, size - pos)
+            for cand in reversed(chains.get(data[pos:pos + MIN_MATCH], ())):
+                off = pos - cand
+                if off > MAX_OFFSET:
+                    break
+                n = MIN_MATCH
+                # Chevauchement autorisé : comparaison octet par octet
+                while n < limit and data[cand + n] == data[pos + n]:
+                    n += 1
+                if n > best_len:
+                    best_len, best_off = n, off
+                    if n == limit:
+                        break
+
+        if best_len >= MIN_MATCH:
+            _flush_literals(out, data, lit_start, pos)
+            out.append(0x80 | (best_len - MIN_MATCH))
+            out.append((best_off >> 8) & 0xFF)
+            out.append(best_off & 0xFF)
+            for p in range(pos, pos + best_len):
+                index(p)
+            pos += best_len
+            lit_start = pos
+        else:
+            index(pos)
+            pos += 1
+
+    _flush_literals(out, data, lit_start, size)
+    return bytes(out)
+
+
+def decompress(packed):
+    """Décompresse un flux MO5 LZ (référence Python du décodeur 6809)."""
+    size = (packed[0] << 8) | packed[1]
+    out = bytearray()
+    src = 2
+    while len(out) < size:
+        c = packed[src]
+        src += 1
+        if c & 0x80:
+            n = (c & 0x7F) + MIN_MATCH
+            off = (packed[src] << 8) | packed[src + 1]
+            src += 2
+            ref = len(out) - off
+            for i in range(n):
+                out.append(out[ref + i])
+        else:
+            n = c + 1
+            out.extend(packed[src:src + n])
+            src += n
+    return bytes(out)
+
+
+def c_array(name, packed, per_line=16):
+    """Formate un flux compressé en tableau C."""
+    lines = [f"unsigned char {name}[{len(packed)}] = {{"]
+    for i in range(0, len(packed), per_line):
+        chunk = ", ".join(f"0x{b:02X}" for b in packed[i:i + per_line])
+        sep = "," if i + per_line < len(packed) else ""
+        lines.append(f"    {chunk}{sep}")
+    lines.append("};")
+    return lines
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: python3 mo5lz.py input.bin output.lz")
+        sys.exit(1)
+
+    with open(sys.argv[1], 'rb') as f:
+        data = f.read()
+
+    packed = compress(data)
+    if decompress(packed) != data:
+        print("[ERREUR] Vérification de la décompression échouée")
+        sys.exit(1)
+
+    with open(sys.argv[2], 'wb') as f:
+        f.write(packed)
+
+    ratio = round(len(packed) * 100.0 / max(1, len(data)), 1)
+    print(f"[OK] {len(data)} -> {len(packed)} octets ({ratio}%)")
+
+
+if __name__ == '__main__':
+    main()
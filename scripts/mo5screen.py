@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""
+mo5screen.py - Format d'écran plein RLE / delta pour le Thomson MO5
+
+Format pensé pour un décodage ligne par ligne directement en VRAM
+(voir src/mo5_screen.c). Chaque ligne de pixels est codée en deux
+segments : banque COULEUR puis banque FORME, 40 octets chacun.
+
+    00nnnnnn     : nnnnnn+1 littéraux suivent               (1..40)
+    01nnnnnn v   : nnnnnn+1 fois l'octet v                  (1..40)
+    10nnnnnn     : nnnnnn+1 octets inchangés (saut, delta)  (1..40)
+    11000000     : fin du segment, reste de la ligne inchangé
+
+En tête de ligne (avant le segment couleur) uniquement :
+
+    11nnnnnn     : nnnnnn lignes entières inchangées (1..63)
+
+Un écran complet n'utilise que littéraux et répétitions. Un écran delta
+(--delta-from) ne code que les octets qui diffèrent de l'écran précédent :
+une transition entre deux écrans proches coûte quelques centaines d'octets.
+
+Usage (module) :
+    import mo5screen
+    stream = mo5screen.encode(form, color)                     # écran complet
+    stream = mo5screen.encode(form, color, prev_form, prev_color)  # delta
+    form, color = mo5screen.decode(stream, prev_form, prev_color)
+"""
+
+ROW_BYTES   = 40
+ROWS        = 200
+BANK_SIZE   = ROW_BYTES * ROWS
+
+OP_LITERAL  = 0x00
+OP_FILL     = 0x40
+OP_SKIP     = 0x80
+OP_END      = 0xC0
+MAX_RUN     = 0x3F + 1      # 64, toujours >= ROW_BYTES
+MAX_ROWS    = 0x3F          # 63 lignes par saut de lignes
+MIN_FILL    = 3             # une répétition plus courte coûte autant qu'un littéral
+MIN_SKIP    = 2
+
+
+def _run(data, x, value):
+    """Longueur de la suite d'octets égaux à value à partir de x."""
+    n = 0
+    while x + n < len(data) and data[x + n] == value:
+        n += 1
+    return n
+
+
+def _same(cur, prev, x):
+    """Longueur de la suite d'octets inchangés à partir de x."""
+    if prev is None:
+        return 0
+    n = 0
+    while x + n < len(cur) and cur[x + n] == prev[x + n]:
+        n += 1
+    return n
+
+
+def _encode_segment(out, cur, prev):
+    """Code une ligne d'une banque (40 octets)."""
+    x = 0
+    lit_start = None
+
+    def flush(end):
+        if lit_start is not None:
+            out.append(OP_LITERAL | (end - lit_start - 1))
+            out.extend(cur[lit_start:end])
+
+    while x < ROW_BYTES:
+        same = _same(cur, prev, x)
+        if same and x + same == ROW_BYTES:
+            # Fin de ligne inchangée : un seul octet de contrôle
+            flush(x)
+            out.append(OP_END)
+            return
+        if same >= MIN_SKIP:
+            flush(x)
+            lit_start = None
+            out.append(OP_SKIP | (same - 1))
+            x += same
+            continue
+        run = _run(cur, x, cur[x])
+        if run >= MIN_FILL:
+            flush(x)
+            lit_start = None
+            out.append(OP_FILL | (run - 1))
+            out.append(cur[x])
+            x += run
+            continue
+        if lit_start is None:
+            lit_start = x
+        x += 1
+
+    flush(ROW_BYTES)
+
+
+def encode(form, color, prev_form=None, prev_color=None):
+    """
+    Code un écran 320x200 (8000 octets par banque).
+    Avec prev_form/prev_color, seuls les octets modifiés sont codés.
+    Retourne un bytes.
+    """
+    if len(form) != BANK_SIZE or len(color) != BANK_SIZE:
+        raise ValueError(f"Un écran plein fait {BANK_SIZE} octets par banque")
+    delta = prev_form is not None and prev_color is not None
+
+    out = bytearray()
+    y = 0
+    while y < ROWS:
+        if delta:
+            # Lignes entièrement inchangées dans les deux banques
+            n = 0
+            while y + n < ROWS and n < MAX_ROWS:
+                a, b = (y + n) * ROW_BYTES, (y + n + 1) * ROW_BYTES
+                if form[a:b] != prev_form[a:b] or color[a:b] != prev_color[a:b]:
+                    break
+                n += 1
+            if n:
+                out.append(OP_END | n)
+                y += n
+                continue
+
+        a, b = y * ROW_BYTES, (y + 1) * ROW_BYTES
+        _encode_segment(out, color[a:b], prev_color[a:b] if delta else None)
+        _encode_segment(out, form[a:b], prev_form[a:b] if delta else None)
+        y += 1
+
+    return bytes(out)
+
+
+def _decode_segment(stream, src, bank, base):
+    x = 0
+    while x < ROW_BYTES:
+        c = stream[src]
+        src += 1
+        n = (c & 0x3F) + 1
+        op = c & 0xC0
+        if op == OP_LITERAL:
+            bank[base + x:base + x + n] = stream[src:src + n]
+            src += n
+        elif op == OP_FILL:
+            bank[base + x:base + x + n] = bytes([stream[src]]) * n
+            src += 1
+        elif op == OP_SKIP:
+            pass
+        else:
+            break
+        x += n
+    return src
+
+
+def decode(stream, prev_form=None, prev_color=None):
+    """Décode un flux (référence Python du décodeur 6809). Retourne (form, color)."""
+    form = bytearray(prev_form if prev_form is not None else BANK_SIZE)
+    color = bytearray(prev_color if prev_color is not None else BANK_SIZE)
+    src = 0
+    y = 0
+    while y < ROWS:
+        c = stream[src]
+        if c > OP_END:
+            src += 1
+            y += c & 0x3F
+            continue
+        src = _decode_segment(stream, src, color, y * ROW_BYTES)
+        src = _decode_segment(stream, src, form, y * ROW_BYTES)
+        y += 1
+    return bytes(form), bytes(color)
@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+"""
+mo5tune.py - Conversion de musiques et bruitages en tables MO5_Note
+
+Lit une notation texte et génère un header C de tables MO5_Note
+(voir include/mo5_sound.h), jouées sur le buzzer par mo5_sound.
+
+Notation (un fichier peut contenir plusieurs tables) :
+
+    [theme]                 début de la table tune_theme
+    C4:4 E4:8 G4:8.         note, octave, durée (1 ronde, 4 noire, 8 croche,
+                            '.' pointée) ; sans durée : celle de la note précédente
+    F#4 Bb3 R:2             dièse, bémol, silence
+    @880:3 @0:2             fréquence en Hz et durée en ticks (bruitages)
+    # commentaire
+
+Le tempo (--tempo, noires par minute) convertit les durées en ticks de
+1/50 s ; --gap retranche des ticks en fin de note pour détacher deux
+notes identiques. Les notations @ ne sont pas affectées.
+
+--burst donne la rafale prévue au jeu (mo5_sound_set_burst, 4000 par
+défaut) : une note dont moins de 2 demi-périodes tiennent dans la rafale
+serait jouée comme un silence ou un clic à 25 Hz, elle est refusée.
+
+Période d'une note (cf. src/mo5_sound.c) :
+
+    demi-période = HALF_BASE + HALF_STEP x period   cycles à 1 MHz
+
+Usage :
+    python3 mo5tune.py music.txt include/assets/music.h
+    python3 mo5tune.py music.txt music.h --tempo 140 --gap 0
+    python3 mo5tune.py music.txt music.h --burst 12000
+"""
+
+import argparse
+import os
+import re
+import sys
+
+CPU_HZ       = 1000000
+TICK_HZ      = 50
+HALF_BASE    = 22       # MO5_SOUND_HALF_BASE
+HALF_STEP    = 8        # MO5_SOUND_HALF_STEP
+MAX_PERIOD   = 8000     # MO5_SOUND_MAX_PERIOD
+BURST        = 4000     # MO5_SOUND_BURST
+MIN_HALVES   = 2        # demi-périodes par rafale pour entendre la note
+MAX_TICKS    = 255
+
+SEMITONES = {'C': 0, 'D': 2, 'E': 4, 'F': 5, 'G': 7, 'A': 9, 'B': 11}
+
+NOTE_RE = re.compile(r'^([A-Ga-g])([#b]?)(\d)(?::(\d+)(\.?))?$')
+REST_RE = re.compile(r'^[Rr](?::(\d+)(\.?))?$')
+RAW_RE  = re.compile(r'^@(\d+):(\d+)$')
+
+
+def note_freq(name, accidental, octave):
+    """Fréquence en Hz d'une note tempérée (A4 = 440 Hz)."""
+    semitone = SEMITONES[name.upper()]
+    if accidental == '#':
+        semitone += 1
+    elif accidental == 'b':
+        semitone -= 1
+    midi = 12 * (octave + 1) + semitone
+    return 440.0 * 2 ** ((midi - 69) / 12.0)
+
+
+def min_freq(burst):
+    """Fréquence la plus basse dont MIN_HALVES demi-périodes tiennent dans la rafale."""
+    period = min(MAX_PERIOD, (burst // MIN_HALVES - HALF_BASE) // HALF_STEP)
+    return CPU_HZ / (2.0 * (HALF_BASE + HALF_STEP * period))
+
+
+def freq_period(freq, burst=BURST):
+    """Période MO5 (unités de délai) la plus proche de freq ; 0 pour un silence."""
+    if freq <= 0:
+        return 0
+    period = round((CPU_HZ / (2.0 * freq) - HALF_BASE) / HALF_STEP)
+    if period < 1:
+        raise ValueError(f"fréquence trop haute ({freq:.0f} Hz)")
+    if period > MAX_PERIOD or burst // (HALF_BASE + HALF_STEP * period) < MIN_HALVES:
+        raise ValueError(f"fréquence trop basse ({freq:.0f} Hz, {min_freq(burst):.0f} Hz "
+                         f"au minimum avec une rafale de {burst} cycles, cf. --burst)")
+    return period
+
+
+def length_ticks(length, dotted, tempo):
+    """Durée en ticks d'une note de valeur 1/length (4 = noire)."""
+    beats = 4.0 / length
+    if dotted:
+        beats *= 1.5
+    return max(1, round(beats * 60.0 * TICK_HZ / tempo))
+
+
+def split_ticks(period, ticks):
+    """Découpe une durée en notes de 255 ticks au plus."""
+    notes = []
+    while ticks > MAX_TICKS:
+        notes.append((period, MAX_TICKS))
+        ticks -= MAX_TICKS
+    notes.append((period, ticks))
+    return notes
+
+
+def parse(text, tempo, gap, burst=BURST):
+    """Retourne la liste ordonnée (nom, [(period, ticks), ...]) des tables du texte."""
+    tunes = []
+    notes = None
+    length, dotted = 4, ''
+
+    for lineno, line in enumerate(text.splitlines(), 1):
+        line = re.sub(r'(^|\s)#.*', '', line).strip()    # '#' en début de mot : commentaire
+        if not line:
+            continue
+
+        section = re.match(r'^\[(\w+)\]$', line)
+        if section:
+            notes = []
+            tunes.append((section.group(1), notes))
+            length, dotted = 4, ''
+            continue
+        if notes is None:
+            raise ValueError(f"ligne {lineno}: note hors d'une table (ajouter [nom])")
+
+        for token in line.replace(',', ' ').split():
+            m = NOTE_RE.match(token)
+            r = REST_RE.match(token)
+            raw = RAW_RE.match(token)
+            try:
+                if raw:
+                    ticks = int(raw.group(2))
+                    if ticks == 0:
+                        raise ValueError("durée nulle")
+                    notes.extend(split_ticks(freq_period(int(raw.group(1)), burst), ticks))
+                    continue
+                if m:
+                    if m.group(4):
+                        length, dotted = int(m.group(4)), m.group(5)
+                    period = freq_period(note_freq(m.group(1), m.group(2), int(m.group(3))), burst)
+                elif r:
+                    if r.group(1):
+                        length, dotted = int(r.group(1)), r.group(2)
+                    period = 0
+                else:
+                    raise ValueError("notation inconnue")
+                if length == 0:
+                    raise ValueError("durée nulle")
+                ticks = length_ticks(length, dotted, tempo)
+            except ValueError as e:
+                raise ValueError(f"ligne {lineno}, '{token}': {e}")
+
+            # Détache la note suivante par un court silence
+            if period and gap and ticks > gap:
+                notes.extend(split_ticks(period, ticks - gap))
+                notes.append((0, gap))
+            else:
+                notes.extend(split_ticks(period, ticks))
+
+    return tunes
+
+
+def c_header(tunes, source, guard):
+    """Formate les tables en header C."""
+    lines = [f"#ifndef {guard}", f"#define {guard}", "",
+             "// =============================================",
+             "// Tables MO5_Note générées par mo5tune.py",
+             f"// Source: {os.path.basename(source)}",
+             "// =============================================", "",
+             '#include "mo5_sound.h"', ""]
+    for name, notes in tunes:
+        ticks = sum(t for _, t in notes)
+        lines.append(f"// {len(notes)} notes, {ticks} ticks ({ticks / TICK_HZ:.2f} s)")
+        lines.append(f"const MO5_Note tune_{name}[{len(notes) + 1}] = {{")
+        for period, t in notes:
+            lines.append(f"    {{ {period}, {t} }},")
+        lines.append("    MO5_NOTE_END")
+        lines.append("};")
+        lines.append("")
+    lines.append(f"#endif // {guard}")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Musiques et bruitages texte -> tables MO5_Note')
+    parser.add_argument('input', help='Fichier texte (notation mo5tune)')
+    parser.add_argument('output', help='Header C généré')
+    parser.add_argument('--tempo', type=int, default=120,
+                        help='Noires par minute (défaut: 120)')
+    parser.add_argument('--gap', type=int, default=1,
+                        help='Ticks de silence en fin de note (défaut: 1)')
+    parser.add_argument('--burst', type=int, default=BURST,
+                        help=f'Rafale en cycles par tick, comme mo5_sound_set_burst (défaut: {BURST})')
+    args = parser.parse_args()
+
+    if args.tempo <= 0:
+        parser.error("tempo invalide")
+    if not 0 < args.burst <= 65535:
+        parser.error("rafale invalide")
+
+    try:
+        with open(args.input, 'r', encoding='utf-8') as f:
+            tunes = parse(f.read(), args.tempo, args.gap, args.burst)
+    except FileNotFoundError:
+        print(f"[ERREUR] Impossible d'ouvrir {args.input}")
+        sys.exit(1)
+    except ValueError as e:
+        print(f"[ERREUR] {e}")
+        sys.exit(1)
+
+    if not tunes:
+        print("[ERREUR] Aucune table ([nom]) dans le fichier")
+        sys.exit(1)
+
+    base = re.sub(r'\W', '_', os.path.splitext(os.path.basename(args.output))[0]).upper()
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write(c_header(tunes, args.input, f"TUNE_{base}_H"))
+
+    for name, notes in tunes:
+        ticks = sum(t for _, t in notes)
+        print(f"[OK] tune_{name}: {len(notes)} notes, {ticks / TICK_HZ:.2f} s")
+
+
+if __name__ == '__main__':
+    main()
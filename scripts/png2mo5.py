@@ -7,13 +7,37 @@ Format: 1 octet = 8 pixels de 1 bit (forme/fond)
 Génère 2 tableaux: FORME (bitmap) et COULEUR (attributs par groupe de 8 pixels)
 
 Usage:
-    python png_to_mo5_v2.py image.png [--name SPRITE_NAME] [--bg-color 0-15] [--transparent]
+    python png_to_mo5_v2.py image.png [--name SPRITE_NAME] [--bg-color 0-15] [--transparent] [--compress]
+    python png_to_mo5_v2.py title.png --screen [--delta-from previous.png]
+    python png_to_mo5_v2.py hero.png --sheet 16x24
+
+Avec --compress, les deux tableaux sont émis au format MO5 LZ (voir mo5lz.py)
+et décompressés à l'exécution par mo5_lz.h.
+
+Avec --screen, une image 320x200 est émise en un seul flux RLE ligne par
+ligne (voir mo5screen.py), décodé directement en VRAM par mo5_screen.h.
+--delta-from ne code que les octets qui diffèrent de l'écran précédent.
+
+Avec --sheet LxH, l'image est une planche découpée en frames de LxH pixels
+(de gauche à droite, de haut en bas). Les plans forme et couleur identiques
+ne sont stockés qu'une fois dans un seul tableau de données, indexé par une
+table de frames (voir mo5_sheet.h).
+
+Contrôle du conflit de couleurs (2 couleurs par groupe de 8 pixels) :
+    --clash-report    liste les groupes à plus de 2 couleurs, avec coordonnées
+    --fix             choisit pour ces groupes le couple de plus faible erreur
+    --dither          avec --fix, retrame ces groupes (diffusion d'erreur)
+    --preview out.png écrit le rendu MO5 réel, sans passer par l'émulateur
 """
 
 import argparse
 import sys
 import os
 from pathlib import Path
+
+import mo5lz
+import mo5screen
+
 try:
     from PIL import Image
 except ImportError:
@@ -133,8 +157,150 @@ def get_dominant_colors_transparent(pixels):
     fg = sorted_colors[0][0]
     return {'Background': 0, 'Foreground': fg, 'IsSingleColor': True}
 
-def convert_png_to_mo5_sprite(image_path, sprite_name=None, default_bg=0, quiet=False, transparent=False):
-    """Convertit une image PNG en sprite MO5"""
+def get_group_colors(pixels):
+    """Ensemble des couleurs MO5 des pixels visibles d'un groupe."""
+    return {get_closest_mo5_color(*p) for p in pixels if p[3] >= 128}
+
+
+def get_form_bits(pixels, bg, fg, dither=False):
+    """
+    Calcule les 8 bits de forme d'un groupe pour le couple (bg, fg).
+
+    Sans dither, chaque pixel prend la couleur la plus proche. Avec dither,
+    l'erreur de chaque pixel est reportée sur le suivant (diffusion sur la
+    ligne du groupe) : un mélange de 3 couleurs est rendu par une trame
+    des 2 couleurs retenues au lieu d'être écrasé sur l'une d'elles.
+    """
+    pf = MO5_PALETTE[fg]
+    pb = MO5_PALETTE[bg]
+    bits = []
+    er = eg = eb = 0
+    for r, g, b, a in pixels:
+        if a < 128 or fg == bg:
+            # Transparent ou bloc monochrome fond : bit 0
+            bits.append(0)
+            er = eg = eb = 0
+            continue
+        r, g, b = r + er, g + eg, b + eb
+        dist_fg = get_color_distance(r, g, b, pf['R'], pf['G'], pf['B'])
+        dist_bg = get_color_distance(r, g, b, pb['R'], pb['G'], pb['B'])
+        chosen = pf if dist_fg < dist_bg else pb
+        bits.append(1 if dist_fg < dist_bg else 0)
+        if dither:
+            er, eg, eb = r - chosen['R'], g - chosen['G'], b - chosen['B']
+    return bits
+
+
+def group_error(pixels, bg, fg, bits, hidden=None):
+    """
+    Erreur du groupe tel qu'affiché (somme des distances). Les pixels
+    transparents sont ignorés, ou comptés comme la couleur hidden : en mode
+    opaque, ils sont dessinés dans le fond du groupe au lieu du fond par défaut.
+    """
+    error = 0
+    for (r, g, b, a), bit in zip(pixels, bits):
+        if a < 128:
+            if hidden is None:
+                continue
+            h = MO5_PALETTE[hidden]
+            r, g, b = h['R'], h['G'], h['B']
+        c = MO5_PALETTE[fg if bit else bg]
+        error += get_color_distance(r, g, b, c['R'], c['G'], c['B'])
+    return error
+
+
+def best_color_pair(pixels, forced_bg=None, hidden=None, dither=False):
+    """
+    Cherche le couple (fond, forme) de plus faible erreur pour un groupe
+    en conflit (recherche exhaustive sur la palette, fond imposé si forced_bg,
+    pixels transparents comptés comme hidden, cf. group_error).
+    """
+    best = None
+    backgrounds = range(16) if forced_bg is None else (forced_bg,)
+    for bg in backgrounds:
+        for fg in range(16):
+            if fg == bg:
+                continue
+            error = group_error(pixels, bg, fg, get_form_bits(pixels, bg, fg, dither), hidden)
+            if best is None or error < best[0]:
+                best = (error, bg, fg)
+    return best[1], best[2]
+
+
+def parse_frame_size(text):
+    """Analyse l'argument de --sheet ("16x24") et retourne (largeur, hauteur)."""
+    try:
+        w, h = (int(v) for v in text.lower().split('x'))
+    except ValueError:
+        raise argparse.ArgumentTypeError(f"taille de frame invalide '{text}' (attendu: LxH, ex. 16x24)")
+    if w <= 0 or h <= 0 or w % 8 != 0:
+        raise argparse.ArgumentTypeError(f"largeur de frame ({w}) non multiple de 8")
+    return w, h
+
+
+MAX_SHEET_FRAMES = 255    # MO5_SpriteSheet.count (unsigned char)
+
+
+def build_sheet(form_bytes, color_bytes, bytes_per_line, height, frame_w, frame_h):
+    """
+    Découpe les plans d'une planche en frames et déduplique les plans identiques.
+
+    Retourne (blob, frames, planes, cols) :
+      blob   : plans uniques concaténés (bytearray)
+      frames : liste de (offset_forme, offset_couleur) par frame
+      planes : liste de [offset, type, frames qui l'utilisent] pour les commentaires
+      cols   : nombre de frames par ligne de la planche
+    """
+    fwb = frame_w // 8
+    cols = bytes_per_line // fwb
+    rows = height // frame_h
+
+    cells = []
+    for r in range(rows):
+        for c in range(cols):
+            form = bytearray()
+            color = bytearray()
+            for y in range(r * frame_h, (r + 1) * frame_h):
+                a = y * bytes_per_line + c * fwb
+                form.extend(form_bytes[a:a + fwb])
+                color.extend(color_bytes[a:a + fwb])
+            cells.append((bytes(form), bytes(color)))
+
+    # Les cases vides en fin de planche ne sont pas des frames
+    while len(cells) > 1 and not any(cells[-1][0]):
+        cells.pop()
+
+    blob = bytearray()
+    index = {}           # (type, plan) -> entrée de planes
+    planes = []
+    frames = []
+    for i, (form, color) in enumerate(cells):
+        entry = []
+        for kind, plane in (('forme', form), ('couleur', color)):
+            key = (kind, plane)
+            if key not in index:
+                index[key] = [len(blob), kind, []]
+                planes.append(index[key])
+                blob.extend(plane)
+            index[key][2].append(i)
+            entry.append(index[key][0])
+        frames.append(tuple(entry))
+
+    return blob, frames, planes, cols
+
+
+def convert_png_to_mo5_sprite(image_path, sprite_name=None, default_bg=0, quiet=False, transparent=False,
+                              compress=False, screen=False, delta_from=None, sheet=None,
+                              clash_report=False, fix=False, dither=False, preview_path=None):
+    """
+    Convertit une image PNG en sprite MO5, en écran plein (screen=True)
+    ou en planche de frames (sheet=(largeur, hauteur) en pixels).
+
+    clash_report : affiche chaque groupe de 8 pixels en conflit (> 2 couleurs)
+    fix          : corrige les groupes en conflit (couple de plus faible erreur)
+    dither       : avec fix, retrame les groupes corrigés (diffusion d'erreur)
+    preview_path : écrit un PNG du rendu MO5 réel
+    """
 
     if not os.path.exists(image_path):
         print(f"[ERREUR] Le fichier '{image_path}' n'existe pas.")
@@ -166,7 +332,15 @@ def convert_png_to_mo5_sprite(image_path, sprite_name=None, default_bg=0, quiet=
             print(f"            Ajustée à {width} pixels")
     
     bytes_per_line = width // 8
-    
+
+    if screen and (bytes_per_line != mo5screen.ROW_BYTES or height != mo5screen.ROWS):
+        print(f"[ERREUR] --screen attend une image 320x200 (reçu {original_width}x{height})")
+        return None
+
+    if sheet and (sheet[0] > width or sheet[1] > height):
+        print(f"[ERREUR] Frame {sheet[0]}x{sheet[1]} plus grande que l'image ({width}x{height})")
+        return None
+
     # Gérer le nom du sprite et le chemin de sortie
     output_path = None
     if sprite_name:
@@ -186,9 +360,13 @@ def convert_png_to_mo5_sprite(image_path, sprite_name=None, default_bg=0, quiet=
     # Tableaux pour stocker les données
     form_data = []
     color_data = []
+    form_bytes = bytearray()
+    color_bytes = bytearray()
     color_stats = {}
     total_blocks = 0
     multi_color_blocks = 0
+    clashes = 0
+    preview = Image.new('RGB', (width, height)) if preview_path else None
     
     # Charger tous les pixels
     pixels = img.load()
@@ -217,7 +395,33 @@ def convert_png_to_mo5_sprite(image_path, sprite_name=None, default_bg=0, quiet=
                 
             bg = colors['Background']
             fg = colors['Foreground']
-            
+
+            # Conflit de couleurs : plus de 2 couleurs visibles dans le groupe
+            fixed = False
+            if clash_report or fix:
+                used = get_group_colors(pixel_group)
+                lost = used - {bg, fg}
+                if lost:
+                    clashes += 1
+                    hidden = None if transparent else default_bg
+                    before = group_error(pixel_group, bg, fg,
+                                         get_form_bits(pixel_group, bg, fg, dither), hidden)
+                    if fix:
+                        bg, fg = best_color_pair(pixel_group, 0 if transparent else None,
+                                                 hidden, dither)
+                        fixed = True
+                    if clash_report:
+                        names = ", ".join(MO5_PALETTE[c]['Name'] for c in sorted(used))
+                        line = (f"[CONFLIT] x={x}-{x + 7} (octet {x // 8}), y={y}: {names} "
+                                f"-> fond {MO5_PALETTE[bg]['Name']}, forme {MO5_PALETTE[fg]['Name']}")
+                        if fixed:
+                            after = group_error(pixel_group, bg, fg,
+                                                get_form_bits(pixel_group, bg, fg, dither), hidden)
+                            line += f" (erreur {before} -> {after})"
+                        else:
+                            line += f" (erreur {before})"
+                        print(line)
+
             total_blocks += 1
             if not colors['IsSingleColor']:
                 multi_color_blocks += 1
@@ -229,55 +433,23 @@ def convert_png_to_mo5_sprite(image_path, sprite_name=None, default_bg=0, quiet=
             # Créer l'octet de COULEUR (FFFFBBBB: Forme en haut, Fond en bas)
             color_byte = (bg & 0x0F) | ((fg & 0x0F) << 4)
             line_color_bytes.append(f"0x{color_byte:02X}")
+            color_bytes.append(color_byte)
             
             # Créer l'octet de FORME (bitmap: 1=forme, 0=fond)
+            bits = get_form_bits(pixel_group, bg, fg, dither=fixed and dither)
             form_byte = 0
             for i in range(8):
-                if x + i < width:
-                    pixel = pixel_group[i]
-                    r, g, b, a = pixel
-                    
-                    if a < 128:
-                        # Transparent = fond (bit 0)
-                        pixel_bit = 0
-                        visual += "-"
-                    else:
-                        # Déterminer si c'est la couleur de forme ou de fond
-                        pixel_color = get_closest_mo5_color(r, g, b, a)
-                        
-                        if pixel_color is not None:
-                            if fg == bg:
-                                # Bloc monochrome fond : tous les pixels = fond
-                                pixel_bit = 0
-                                visual += "-"
-                            else:
-                                # Si la couleur est plus proche de fg que de bg
-                                dist_fg = get_color_distance(r, g, b,
-                                                            MO5_PALETTE[fg]['R'],
-                                                            MO5_PALETTE[fg]['G'],
-                                                            MO5_PALETTE[fg]['B'])
-                                dist_bg = get_color_distance(r, g, b,
-                                                            MO5_PALETTE[bg]['R'],
-                                                            MO5_PALETTE[bg]['G'],
-                                                            MO5_PALETTE[bg]['B'])
-
-                                if dist_fg < dist_bg:
-                                    pixel_bit = 1  # Forme
-                                    visual += "█"
-                                else:
-                                    pixel_bit = 0  # Fond
-                                    visual += "-"
-                        else:
-                            pixel_bit = 0
-                            visual += "-"
-                    
-                    # Positionner le bit (MSB = pixel de gauche)
-                    shift = 7 - i
-                    form_byte |= (pixel_bit << shift)
-                else:
-                    visual += "-"
-            
+                # Positionner le bit (MSB = pixel de gauche)
+                form_byte |= bits[i] << (7 - i)
+                visual += "█" if bits[i] else "-"
+
+            if preview is not None:
+                for i in range(8):
+                    c = MO5_PALETTE[fg if bits[i] else bg]
+                    preview.putpixel((x + i, y), (c['R'], c['G'], c['B']))
+
             line_form_bytes.append(f"0x{form_byte:02X}")
+            form_bytes.append(form_byte)
         
         # Ajouter les lignes
         form_line = "    " + ", ".join(line_form_bytes)
@@ -293,6 +465,18 @@ def convert_png_to_mo5_sprite(image_path, sprite_name=None, default_bg=0, quiet=
         form_data.append(form_line)
         color_data.append(color_line)
     
+    if clash_report or fix:
+        if clashes:
+            action = "corrigés" if fix else "non corrigés (--fix pour corriger)"
+            print(f"[INFO] {clashes} groupe(s) de 8 pixels en conflit de couleurs, {action}")
+        else:
+            print("[OK] Aucun conflit de couleurs")
+
+    if preview is not None:
+        preview.save(preview_path)
+        if not quiet:
+            print(f"[OK] Aperçu MO5 sauvegardé dans: {preview_path}")
+
     # Construire le code C avec include guards
     guard_name = f"SPRITE_{sprite_name_clean.upper()}_H"
 
@@ -310,26 +494,110 @@ def convert_png_to_mo5_sprite(image_path, sprite_name=None, default_bg=0, quiet=
     output.append("")
 
     # Ajouter les defines pour les dimensions
-    output.append(f"#define SPRITE_{sprite_name_clean.upper()}_WIDTH_BYTES {bytes_per_line}")
-    output.append(f"#define SPRITE_{sprite_name_clean.upper()}_HEIGHT {height}")
-    output.append("")
+    if not sheet:
+        output.append(f"#define SPRITE_{sprite_name_clean.upper()}_WIDTH_BYTES {bytes_per_line}")
+        output.append(f"#define SPRITE_{sprite_name_clean.upper()}_HEIGHT {height}")
+        output.append("")
 
-    output.append("// Données de FORME (bitmap: 1=forme, 0=fond)")
-    output.append(f"unsigned char sprite_{sprite_name_clean}_form[{bytes_per_line * height}] = {{")
-    output.extend(form_data)
-    output.append("};")
-    output.append("")
-    output.append("// Données de COULEUR (attributs par groupe de 8 pixels)")
-    output.append("// Format: FFFFBBBB (Forme bits 4-7, Fond bits 0-3)")
-    output.append(f"unsigned char sprite_{sprite_name_clean}_color[{bytes_per_line * height}] = {{")
-    output.extend(color_data)
-    output.append("};")
-    output.append("")
-    output.append(f"// Taille totale: {bytes_per_line * height} octets par tableau")
+    packed_size = 0
+    prev = None
+    if screen and delta_from:
+        prev = convert_png_to_mo5_sprite(delta_from, None, default_bg, True, transparent, screen=True)
+        if prev is None:
+            return None
+
+    if sheet:
+        frame_w, frame_h = sheet
+        blob, frames, planes, cols = build_sheet(form_bytes, color_bytes, bytes_per_line, height,
+                                                 frame_w, frame_h)
+        if len(frames) > MAX_SHEET_FRAMES:
+            # MO5_SpriteSheet.count est un unsigned char
+            print(f"[ERREUR] {len(frames)} frames de {frame_w}x{frame_h} pixels: "
+                  f"{MAX_SHEET_FRAMES} au maximum par planche (frames plus grandes ou planche découpée)")
+            return None
+        packed_size = len(blob) + 4 * len(frames)
+        fwb = frame_w // 8
+        plane_size = fwb * frame_h
+        SN = sprite_name_clean.upper()
+
+        output.append('#include "mo5_sheet.h"')
+        output.append("")
+        output.append(f"// Planche: frames de {frame_w}x{frame_h} pixels, {cols} par ligne")
+        output.append(f"#define SHEET_{SN}_WIDTH_BYTES {fwb}")
+        output.append(f"#define SHEET_{SN}_HEIGHT {frame_h}")
+        output.append(f"#define SHEET_{SN}_COLS {cols}")
+        output.append(f"#define SHEET_{SN}_FRAME_COUNT {len(frames)}")
+        output.append("")
+        output.append(f"// Plans uniques: {len(planes)} sur {2 * len(frames)} "
+                      f"({plane_size} octets chacun)")
+        output.append(f"unsigned char sheet_{sprite_name_clean}_data[{len(blob)}] = {{")
+        for n, (offset, kind, users) in enumerate(planes):
+            output.append(f"    // +{offset}: {kind}, frame(s) {', '.join(str(u) for u in users)}")
+            for y in range(frame_h):
+                row = blob[offset + y * fwb:offset + (y + 1) * fwb]
+                last = n == len(planes) - 1 and y == frame_h - 1
+                output.append("    " + ", ".join(f"0x{b:02X}" for b in row) + ("" if last else ","))
+        output.append("};")
+        output.append("")
+        output.append("// Table des frames: { offset forme, offset couleur }")
+        output.append(f"const MO5_SheetFrame sheet_{sprite_name_clean}_frames[{len(frames)}] = {{")
+        for i, (fo, co) in enumerate(frames):
+            sep = "," if i < len(frames) - 1 else " "
+            output.append(f"    {{ {fo:5d}, {co:5d} }}{sep}  // {i}")
+        output.append("};")
+        output.append("")
+        raw = 2 * plane_size * len(frames)
+        output.append(f"// Taille: {packed_size} octets (données + table) au lieu de {raw} "
+                      f"({round(packed_size * 100.0 / raw, 1)}%)")
+    elif screen:
+        if prev:
+            stream = mo5screen.encode(form_bytes, color_bytes, prev['FormBytes'], prev['ColorBytes'])
+        else:
+            stream = mo5screen.encode(form_bytes, color_bytes)
+        packed_size = len(stream)
+
+        if prev:
+            output.append(f"// Écran DELTA depuis {os.path.basename(delta_from)} (format RLE ligne par ligne, voir mo5_screen.h)")
+            output.append("// À dessiner par-dessus cet écran uniquement")
+        else:
+            output.append("// Écran plein (format RLE ligne par ligne, voir mo5_screen.h)")
+        output.extend(mo5lz.c_array(f"screen_{sprite_name_clean}_rle", stream))
+        output.append("")
+        output.append(f"// Taille: {packed_size} octets au lieu de {2 * bytes_per_line * height} "
+                      f"({round(packed_size * 100.0 / (2 * bytes_per_line * height), 1)}%)")
+    elif compress:
+        form_lz = mo5lz.compress(form_bytes)
+        color_lz = mo5lz.compress(color_bytes)
+        packed_size = len(form_lz) + len(color_lz)
+
+        output.append("// Données de FORME compressées (format MO5 LZ, voir mo5_lz.h)")
+        output.extend(mo5lz.c_array(f"sprite_{sprite_name_clean}_form_lz", form_lz))
+        output.append("")
+        output.append("// Données de COULEUR compressées (format MO5 LZ, FFFFBBBB une fois décompressées)")
+        output.extend(mo5lz.c_array(f"sprite_{sprite_name_clean}_color_lz", color_lz))
+        output.append("")
+        output.append(f"// Taille décompressée: {bytes_per_line * height} octets par tableau")
+        output.append(f"// Taille compressée: {len(form_lz)} + {len(color_lz)} = {packed_size} octets "
+                      f"({round(packed_size * 100.0 / (2 * bytes_per_line * height), 1)}%)")
+    else:
+        output.append("// Données de FORME (bitmap: 1=forme, 0=fond)")
+        output.append(f"unsigned char sprite_{sprite_name_clean}_form[{bytes_per_line * height}] = {{")
+        output.extend(form_data)
+        output.append("};")
+        output.append("")
+        output.append("// Données de COULEUR (attributs par groupe de 8 pixels)")
+        output.append("// Format: FFFFBBBB (Forme bits 4-7, Fond bits 0-3)")
+        output.append(f"unsigned char sprite_{sprite_name_clean}_color[{bytes_per_line * height}] = {{")
+        output.extend(color_data)
+        output.append("};")
+        output.append("")
+        output.append(f"// Taille totale: {bytes_per_line * height} octets par tableau")
 
     if total_blocks > 0:
         percentage = round(multi_color_blocks * 100.0 / total_blocks, 1)
         output.append(f"// Blocs multi-couleurs: {multi_color_blocks} / {total_blocks} ({percentage}%)")
+    if clash_report or fix:
+        output.append(f"// Groupes en conflit: {clashes}" + (" (corrigés)" if fix and clashes else ""))
     output.append("")
 
     if color_stats:
@@ -344,17 +612,44 @@ def convert_png_to_mo5_sprite(image_path, sprite_name=None, default_bg=0, quiet=
             output.append(f"//   Fond={bg_name}, Forme={fg_name} : {count} blocs de 8 pixels")
         output.append("")
 
-    # Macro d'initialisation MO5_Sprite
     sn = sprite_name_clean
     SN = sprite_name_clean.upper()
-    output.append(f"// Macro d'initialisation pour MO5_Sprite (voir mo5_sprite.h)")
-    output.append(f"#define SPRITE_{SN}_INIT \\")
-    output.append(f"    {{ sprite_{sn}_form, sprite_{sn}_color, \\")
-    output.append(f"      SPRITE_{SN}_WIDTH_BYTES, SPRITE_{SN}_HEIGHT }}")
-    output.append("")
-    output.append(f"// Utilisation:")
-    output.append(f"//   MO5_Sprite sprite_{sn} = SPRITE_{SN}_INIT;")
-    output.append("")
+    if sheet:
+        output.append(f"// Macro d'initialisation pour MO5_SpriteSheet (voir mo5_sheet.h)")
+        output.append(f"#define SHEET_{SN}_INIT \\")
+        output.append(f"    {{ sheet_{sn}_data, sheet_{sn}_frames, \\")
+        output.append(f"      SHEET_{SN}_WIDTH_BYTES, SHEET_{SN}_HEIGHT, SHEET_{SN}_FRAME_COUNT }}")
+        output.append("")
+        output.append(f"// Utilisation:")
+        output.append(f"//   MO5_SpriteSheet sheet_{sn} = SHEET_{SN}_INIT;")
+        output.append(f"//   mo5_sheet_frame(&sheet_{sn}, index, &sprite);")
+        output.append("")
+    elif screen:
+        output.append(f"// Utilisation:")
+        output.append(f"//   mo5_screen_draw(screen_{sn}_rle);")
+        output.append("")
+    elif compress:
+        # Macro d'initialisation MO5_PackedSprite
+        output.append(f"// Macro d'initialisation pour MO5_PackedSprite (voir mo5_lz.h)")
+        output.append(f"#define SPRITE_{SN}_PACKED_INIT \\")
+        output.append(f"    {{ sprite_{sn}_form_lz, sprite_{sn}_color_lz, \\")
+        output.append(f"      SPRITE_{SN}_WIDTH_BYTES, SPRITE_{SN}_HEIGHT }}")
+        output.append("")
+        output.append(f"// Utilisation:")
+        output.append(f"//   MO5_PackedSprite packed_{sn} = SPRITE_{SN}_PACKED_INIT;")
+        output.append(f"//   MO5_Sprite       sprite_{sn};")
+        output.append(f"//   mo5_lz_unpack_sprite(&level_arena, &packed_{sn}, &sprite_{sn});")
+        output.append("")
+    else:
+        # Macro d'initialisation MO5_Sprite
+        output.append(f"// Macro d'initialisation pour MO5_Sprite (voir mo5_sprite.h)")
+        output.append(f"#define SPRITE_{SN}_INIT \\")
+        output.append(f"    {{ sprite_{sn}_form, sprite_{sn}_color, \\")
+        output.append(f"      SPRITE_{SN}_WIDTH_BYTES, SPRITE_{SN}_HEIGHT }}")
+        output.append("")
+        output.append(f"// Utilisation:")
+        output.append(f"//   MO5_Sprite sprite_{sn} = SPRITE_{SN}_INIT;")
+        output.append("")
     output.append(f"#endif // {guard_name}")
     
     img.close()
@@ -368,11 +663,19 @@ def convert_png_to_mo5_sprite(image_path, sprite_name=None, default_bg=0, quiet=
         'BytesPerLine': bytes_per_line,
         'ColorStats': color_stats,
         'MultiColorBlocks': multi_color_blocks,
-        'TotalBlocks': total_blocks
+        'TotalBlocks': total_blocks,
+        'Compressed': compress,
+        'Screen': screen,
+        'Sheet': sheet,
+        'Clashes': clashes,
+        'PackedSize': packed_size,
+        'FormBytes': bytes(form_bytes),
+        'ColorBytes': bytes(color_bytes)
     }
 
 
-def main():
+def build_parser():
+    """Construit l'analyseur de la ligne de commande (réutilisé par mo5assets.py)."""
     parser = argparse.ArgumentParser(
         description='Convertisseur PNG vers sprite Thomson MO5',
         formatter_class=argparse.RawDescriptionHelpFormatter,
@@ -390,10 +693,52 @@ Exemples:
                        help='Couleur de fond par défaut (0-15, défaut: 0=noir)')
     parser.add_argument('--transparent', action='store_true',
                        help='Force le fond à 0 pour mo5_sprite_bg')
+    parser.add_argument('--compress', action='store_true',
+                       help='Compresse forme et couleur au format MO5 LZ (voir mo5_lz.h)')
+    parser.add_argument('--screen', action='store_true',
+                       help='Écran plein 320x200 au format RLE ligne par ligne (voir mo5_screen.h)')
+    parser.add_argument('--delta-from', dest='delta_from', metavar='PREV.png',
+                       help='Avec --screen, ne code que les différences avec cet écran')
+    parser.add_argument('--sheet', type=parse_frame_size, metavar='LxH',
+                       help='Planche de frames de LxH pixels, plans dédupliqués (voir mo5_sheet.h)')
+    parser.add_argument('--clash-report', dest='clash_report', action='store_true',
+                       help='Affiche les groupes de 8 pixels à plus de 2 couleurs, avec coordonnées')
+    parser.add_argument('--fix', action='store_true',
+                       help='Corrige les groupes en conflit (couple de couleurs de plus faible erreur)')
+    parser.add_argument('--dither', action='store_true',
+                       help='Avec --fix, retrame les groupes corrigés par diffusion d\'erreur')
+    parser.add_argument('--preview', dest='preview_path', metavar='APERCU.png',
+                       help='Écrit un PNG de ce que le MO5 affichera')
     parser.add_argument('--quiet', '-q', action='store_true',
                        help='Mode silencieux (affiche uniquement le message final)')
+    return parser
+
+
+def parse_args(argv=None):
+    """Analyse et vérifie les options (argv=None : ligne de commande)."""
+    parser = build_parser()
+    args = parser.parse_args(argv)
+
+    if args.dither and not args.fix:
+        parser.error("--dither nécessite --fix")
 
-    args = parser.parse_args()
+    if args.delta_from and not args.screen:
+        parser.error("--delta-from nécessite --screen")
+    if sum(1 for mode in (args.screen, args.compress, args.sheet) if mode) > 1:
+        parser.error("--screen, --compress et --sheet sont exclusifs")
+    return args
+
+
+def convert_from_args(args):
+    """Lance la conversion décrite par les options analysées."""
+    return convert_png_to_mo5_sprite(args.image_path, args.sprite_name, args.bg_color, args.quiet,
+                                     args.transparent, args.compress, args.screen, args.delta_from,
+                                     args.sheet, args.clash_report, args.fix, args.dither,
+                                     args.preview_path)
+
+
+def main():
+    args = parse_args()
 
     if not args.quiet:
         print()
@@ -404,7 +749,7 @@ Exemples:
         print("=" * 60)
         print()
 
-    result = convert_png_to_mo5_sprite(args.image_path, args.sprite_name, args.bg_color, args.quiet, args.transparent)
+    result = convert_from_args(args)
     
     if result:
         if not args.quiet:
@@ -415,21 +760,38 @@ Exemples:
             print()
             print("[OK] Sprite généré avec succès!")
             print()
-            print("[INFO] Le sprite utilise 2 tableaux:")
-            print(f"       - sprite_{result['SpriteName']}_form  (bitmap 1 bit/pixel)")
-            print(f"       - sprite_{result['SpriteName']}_color (attributs couleur)")
+            if result['Sheet']:
+                print("[INFO] La planche utilise 2 tableaux:")
+                print(f"       - sheet_{result['SpriteName']}_data   (plans forme/couleur uniques)")
+                print(f"       - sheet_{result['SpriteName']}_frames (table des frames)")
+            elif result['Screen']:
+                print("[INFO] L'écran utilise 1 tableau:")
+                print(f"       - screen_{result['SpriteName']}_rle (couleur + forme, ligne par ligne)")
+            else:
+                print("[INFO] Le sprite utilise 2 tableaux:")
+                suffix = "_lz" if result['Compressed'] else ""
+                print(f"       - sprite_{result['SpriteName']}_form{suffix}  (bitmap 1 bit/pixel)")
+                print(f"       - sprite_{result['SpriteName']}_color{suffix} (attributs couleur)")
             print()
             print("[STATS] Analyse:")
             print(f"        Blocs multi-couleurs: {result['MultiColorBlocks']}/{result['TotalBlocks']}")
+            if result['Compressed'] or result['Screen'] or result['Sheet']:
+                raw_size = 2 * result['BytesPerLine'] * result['Height']
+                print(f"        Compression: {raw_size} -> {result['PackedSize']} octets")
             if result['TotalBlocks'] > 0:
                 percentage = round(result['MultiColorBlocks'] * 100.0 / result['TotalBlocks'], 1)
                 print(f"        Pourcentage: {percentage}%")
             print()
             print("[INFO] Utilisation:")
-            print(f"       draw_sprite_multicolor(x, y,")
-            print(f"                              sprite_{result['SpriteName']}_form,")
-            print(f"                              sprite_{result['SpriteName']}_color,")
-            print(f"                              {result['BytesPerLine']}, {result['Height']});")
+            if result['Sheet']:
+                print(f"       mo5_sheet_frame(&sheet_{result['SpriteName']}, index, &sprite);")
+            elif result['Screen']:
+                print(f"       mo5_screen_draw(screen_{result['SpriteName']}_rle);")
+            else:
+                print(f"       draw_sprite_multicolor(x, y,")
+                print(f"                              sprite_{result['SpriteName']}_form,")
+                print(f"                              sprite_{result['SpriteName']}_color,")
+                print(f"                              {result['BytesPerLine']}, {result['Height']});")
             print()
 
         # Sauvegarder
@@ -22,7 +22,7 @@ static void dr_transfer(unsigned char tx,          unsigned char ty,
                         unsigned char width_bytes, unsigned char height,
                         unsigned char *buf,        unsigned char dir)
 {
-    unsigned char *row      = VRAM + (unsigned int)ty * SCREEN_WIDTH_BYTES + tx;
+    unsigned char *row      = VRAM_ADDR(tx, ty);
     unsigned char  rows_left = height;
 
     while (rows_left--) {
@@ -73,12 +73,17 @@ static void dr_restore(MO5_Actor_DR *actor)
 
 static void dr_draw(MO5_Actor_DR *actor)
 {
-    unsigned char *row       = VRAM + (unsigned int)actor->pos.y * SCREEN_WIDTH_BYTES
-                                    + actor->pos.x;
+    unsigned char *row       = VRAM_ADDR(actor->pos.x, actor->pos.y);
     unsigned char *color_src = actor->sprite->color;
     unsigned char *form_src  = actor->sprite->form;
     unsigned char  rows_left = actor->sprite->height;
 
+    if (actor->flip) {
+        mo5_draw_sprite_bg_flip(actor->pos.x, actor->pos.y, form_src, color_src,
+                                actor->sprite->width_bytes, rows_left, actor->flip);
+        return;
+    }
+
     while (rows_left--) {
         unsigned char *p   = row;
         unsigned char  col = actor->sprite->width_bytes;
@@ -113,6 +118,7 @@ void mo5_actor_dr_init(MO5_Actor_DR *actor, const MO5_Sprite *sprite,
     actor->sprite = sprite;
     actor->pos.x  = x;
     actor->pos.y  = y;
+    actor->flip   = MO5_FLIP_NONE;
     dr_save(actor);
     dr_draw(actor);
 }
@@ -132,4 +138,9 @@ void mo5_actor_dr_move(MO5_Actor_DR *actor, unsigned char x, unsigned char y)
 {
     actor->pos.x = x;
     actor->pos.y = y;
+}
+
+void mo5_actor_dr_set_flip(MO5_Actor_DR *actor, unsigned char flip)
+{
+    actor->flip = flip;
 }
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @brief Sprite animation — implémentation.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_anim.h"
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/* Passe à l'entrée suivante selon le mode. Retourne 0 si l'animation est finie. */
+static unsigned char anim_next(MO5_Anim *anim)
+{
+    const MO5_AnimDef *def  = anim->def;
+    unsigned char      last = def->count - 1;
+
+    switch (def->mode) {
+    case MO5_ANIM_PINGPONG:
+        if (last == 0)
+            break;
+        if (anim->step == last)
+            anim->dir = -1;
+        else if (anim->step == 0)
+            anim->dir = 1;
+        anim->step += anim->dir;
+        break;
+    case MO5_ANIM_ONCE:
+        if (anim->step == last) {
+            anim->done = 1;
+            return 0;
+        }
+        anim->step++;
+        break;
+    default:
+        anim->step = (anim->step == last) ? 0 : anim->step + 1;
+        break;
+    }
+
+    anim->timer = def->durations[anim->step];
+    return 1;
+}
+
+/* Frame en attente si elle diffère de celle affichée. */
+static unsigned char anim_check(MO5_Anim *anim)
+{
+    anim->pending = (anim->def->frames[anim->step] != anim->shown);
+    return anim->pending;
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_anim_init(MO5_Anim *anim, const MO5_SpriteSheet *sheet, const MO5_AnimDef *def)
+{
+    anim->sheet = sheet;
+    anim->def   = NULL;
+    anim->shown = def->frames[0];
+    mo5_anim_play(anim, def);
+
+    mo5_sheet_frame(sheet, anim->shown, &anim->sprite);
+}
+
+void mo5_anim_play(MO5_Anim *anim, const MO5_AnimDef *def)
+{
+    if (anim->def == def)
+        return;
+
+    anim->def   = def;
+    anim->step  = 0;
+    anim->timer = def->durations[0];
+    anim->dir   = 1;
+    anim->done  = 0;
+    anim_check(anim);
+}
+
+unsigned char mo5_anim_update(MO5_Anim *anim, unsigned char elapsed)
+{
+    if (anim->done)
+        return anim->pending;
+
+    /* Plusieurs entrées peuvent être franchies si elapsed est grand */
+    while (elapsed >= anim->timer) {
+        elapsed -= anim->timer;
+        if (!anim_next(anim))
+            return anim_check(anim);
+    }
+    anim->timer -= elapsed;
+
+    return anim_check(anim);
+}
+
+unsigned char mo5_anim_apply(MO5_Anim *anim)
+{
+    if (!anim->pending)
+        return 0;
+
+    anim->shown   = anim->def->frames[anim->step];
+    anim->pending = 0;
+    mo5_sheet_frame(anim->sheet, anim->shown, &anim->sprite);
+    return 1;
+}
+
+void mo5_anim_actor_move(MO5_Actor *actor, MO5_Anim *anim,
+                         unsigned char new_x, unsigned char new_y,
+                         const MO5_AnimEngine *engine)
+{
+    if (!anim->pending) {
+        engine->move(actor, new_x, new_y);
+        return;
+    }
+
+    /* Effacement avec l'ancienne frame, puis affichage de la nouvelle */
+    engine->clear(actor);
+    mo5_anim_apply(anim);
+
+    actor->old_pos = actor->pos;
+    actor->pos.x   = new_x;
+    actor->pos.y   = new_y;
+    actor->sprite  = &anim->sprite;
+    engine->draw(actor);
+}
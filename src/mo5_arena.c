@@ -0,0 +1,46 @@
+/**
+ * @file
+ * @brief Linear (bump-pointer) arena allocator — implémentation.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_arena.h"
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_arena_init(MO5_Arena *arena, void *buf, unsigned int size)
+{
+    arena->base = (unsigned char *)buf;
+    arena->top  = arena->base;
+    arena->end  = arena->base + size;
+    arena->high = arena->base;
+}
+
+void *mo5_arena_alloc(MO5_Arena *arena, unsigned int size)
+{
+    unsigned char *p = arena->top;
+
+    /* Comparaison sur la place restante : pas de débordement de pointeur */
+    if (size > (unsigned int)(arena->end - p))
+        return NULL;
+
+    arena->top = p + size;
+    if (arena->top > arena->high)
+        arena->high = arena->top;
+
+    return p;
+}
+
+void mo5_arena_release(MO5_Arena *arena, MO5_ArenaMark mark)
+{
+    arena->top = mark;
+}
+
+void mo5_arena_reset(MO5_Arena *arena)
+{
+    arena->top = arena->base;
+}
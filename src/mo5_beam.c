@@ -0,0 +1,170 @@
+/**
+ * @file
+ * @brief Race-the-beam draw scheduler — implémentation.
+ *
+ * Modèle temporel (t en cycles depuis le début du VBL) :
+ *   le faisceau atteint la ligne y à  t = beam_blank + y * 64
+ *
+ * Une requête est dessinée "devant" le faisceau si elle se termine avant
+ * qu'il n'atteigne sa première ligne. Sinon elle est différée et dessinée
+ * "derrière", une fois le faisceau passé sous sa dernière ligne : le
+ * faisceau descend bien plus vite que le dessin, il ne peut plus la rattraper.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_beam.h"
+
+// ============================================================================
+// ÉTAT INTERNE
+// ============================================================================
+
+static MO5_BeamCmd   beam_cmds[MO5_BEAM_MAX];   // triées par top croissant
+static unsigned char beam_late[MO5_BEAM_MAX];   // indices différés, triés par bottom
+static unsigned char beam_count;
+
+static unsigned int  beam_blank;   // cycles entre début VBL et ligne 0
+static unsigned int  beam_cps;     // cycles par spin de scrutation
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/* Cycles écoulés au moment où le faisceau atteint la ligne y. */
+static unsigned int beam_line_time(unsigned char y)
+{
+    return beam_blank + ((unsigned int)y << MO5_BEAM_LINE_SHIFT);
+}
+
+/* Insère l'indice i dans beam_late, trié par bottom croissant. */
+static void beam_defer(unsigned char i, unsigned char n_late)
+{
+    unsigned char bottom = beam_cmds[i].bottom;
+
+    while (n_late && beam_cmds[beam_late[n_late - 1]].bottom > bottom) {
+        beam_late[n_late] = beam_late[n_late - 1];
+        n_late--;
+    }
+    beam_late[n_late] = i;
+}
+
+/*
+ * Attente active d'environ `cycles` cycles.
+ * Interrompue si un nouveau VBL commence (frame terminée).
+ */
+static void beam_delay(unsigned int cycles)
+{
+    unsigned int n = cycles / beam_cps;
+
+    while (n--) {
+        if (*VBL_REG & VBL_BIT) return;
+    }
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_beam_init(void)
+{
+    unsigned int blank;
+    unsigned int display;
+
+    /* Calage sur un début de VBL */
+    while ( *VBL_REG &  VBL_BIT) ;
+    while (!(*VBL_REG & VBL_BIT)) ;
+
+    blank = 0;
+    while ( *VBL_REG &  VBL_BIT) blank++;
+    display = 0;
+    while (!(*VBL_REG & VBL_BIT)) display++;
+
+    beam_cps   = MO5_FRAME_CYCLES / (blank + display);
+    beam_blank = blank * beam_cps;
+    beam_count = 0;
+}
+
+void mo5_beam_add(MO5_BeamDraw draw, void *obj,
+                  unsigned char y, unsigned char h, unsigned int cost)
+{
+    MO5_BeamCmd  *c;
+    unsigned char i;
+
+    if (beam_count >= MO5_BEAM_MAX) {
+        draw(obj);
+        return;
+    }
+
+    /* Tri par insertion : la file reste triée par top */
+    i = beam_count++;
+    while (i && beam_cmds[i - 1].top > y) {
+        beam_cmds[i] = beam_cmds[i - 1];
+        i--;
+    }
+
+    c         = &beam_cmds[i];
+    c->draw   = draw;
+    c->obj    = obj;
+    c->top    = y;
+    c->bottom = y + h;
+    c->cost   = cost;
+}
+
+void mo5_beam_add_actor(MO5_BeamDraw draw, const MO5_Actor *actor,
+                        unsigned char cpb)
+{
+    unsigned char h    = actor->sprite->height;
+    unsigned int  size = (unsigned int)actor->sprite->width_bytes * h;
+
+    mo5_beam_add(draw, (void *)actor, actor->pos.y, h, size * cpb);
+}
+
+void mo5_beam_flush(void)
+{
+    MO5_BeamCmd  *c;
+    unsigned char i;
+    unsigned char n_late;
+    unsigned int  t;
+    unsigned int  target;
+
+    /* 1. Devant le faisceau, de haut en bas */
+    t      = 0;
+    n_late = 0;
+    c      = beam_cmds;
+    for (i = 0; i < beam_count; i++, c++) {
+        if (t + c->cost <= beam_line_time(c->top)) {
+            c->draw(c->obj);
+            t += c->cost;
+        } else {
+            beam_defer(i, n_late++);
+        }
+    }
+
+    /* 2. Derrière le faisceau, dans l'ordre des lignes basses */
+    if (n_late) {
+        /* Encore dans le VBL : on se recale exactement sur la ligne 0 */
+        if (*VBL_REG & VBL_BIT) {
+            while (*VBL_REG & VBL_BIT) ;
+            t = beam_blank;
+        }
+
+        for (i = 0; i < n_late; i++) {
+            c      = &beam_cmds[beam_late[i]];
+            target = beam_line_time(c->bottom);
+            if (t < target) {
+                beam_delay(target - t);
+                t = target;
+            }
+            c->draw(c->obj);
+            t += c->cost;
+        }
+    }
+
+    beam_count = 0;
+}
+
+void mo5_beam_clear(void)
+{
+    beam_count = 0;
+}
@@ -1,9 +1,11 @@
 /**
  * @file
- * @brief Implementation of character classification functions.
+ * @brief Character classification — table and function versions.
  *
- * Retourne unsigned char au lieu de int — 0 ou 1 suffit,
- * évite les opérations 16 bits sur 6809.
+ * Les macros de mo5_ctype.h indexent mo5_ctype_table : un LDB indexé et
+ * un ANDB, sans appel ni comparaison de bornes. Les fonctions ci-dessous
+ * (nom entre parenthèses pour ne pas déclencher les macros) gardent
+ * l'ancien contrat 0/1.
  *
  * SPDX-License-Identifier: MIT
  * Copyright (c) 2026 Thierry Le Got
@@ -11,21 +13,52 @@
 
 #include "mo5_ctype.h"
 
-unsigned char islower(char c) {
-    return (c >= 'a' && c <= 'z') ? 1 : 0;
+#define L  MO5_CT_LOWER
+#define U  MO5_CT_UPPER
+#define D  MO5_CT_DIGIT
+#define P  MO5_CT_PUNCT
+#define S  MO5_CT_SPACE
+#define R  MO5_CT_PRINT
+
+const unsigned char mo5_ctype_table[256] = {
+    0,    0,    0,    0,    0,    0,    0,    0,  /* 00-07 */
+    0,    S,    S,    S,    S,    S,    0,    0,  /* 08-0F */
+    0,    0,    0,    0,    0,    0,    0,    0,  /* 10-17 */
+    0,    0,    0,    0,    0,    0,    0,    0,  /* 18-1F */
+    S|R,  P|R,  P|R,  P|R,  P|R,  P|R,  P|R,  P|R,  /* 20-27 */
+    P|R,  P|R,  P|R,  P|R,  P|R,  P|R,  P|R,  P|R,  /* 28-2F */
+    D|R,  D|R,  D|R,  D|R,  D|R,  D|R,  D|R,  D|R,  /* 30-37 */
+    D|R,  D|R,  P|R,  P|R,  P|R,  P|R,  P|R,  P|R,  /* 38-3F */
+    P|R,  U|R,  U|R,  U|R,  U|R,  U|R,  U|R,  U|R,  /* 40-47 */
+    U|R,  U|R,  U|R,  U|R,  U|R,  U|R,  U|R,  U|R,  /* 48-4F */
+    U|R,  U|R,  U|R,  U|R,  U|R,  U|R,  U|R,  U|R,  /* 50-57 */
+    U|R,  U|R,  U|R,  P|R,  P|R,  P|R,  P|R,  P|R,  /* 58-5F */
+    P|R,  L|R,  L|R,  L|R,  L|R,  L|R,  L|R,  L|R,  /* 60-67 */
+    L|R,  L|R,  L|R,  L|R,  L|R,  L|R,  L|R,  L|R,  /* 68-6F */
+    L|R,  L|R,  L|R,  L|R,  L|R,  L|R,  L|R,  L|R,  /* 70-77 */
+    L|R,  L|R,  L|R,  P|R,  P|R,  P|R,  P|R,  0,  /* 78-7F */
+    /* 80-FF : aucune classe */
+};
+
+#undef L
+#undef U
+#undef D
+#undef P
+#undef S
+#undef R
+
+unsigned char (islower)(char c) {
+    return islower(c) ? 1 : 0;
 }
 
-unsigned char isupper(char c) {
-    return (c >= 'A' && c <= 'Z') ? 1 : 0;
+unsigned char (isupper)(char c) {
+    return isupper(c) ? 1 : 0;
 }
 
-unsigned char isprint(char c) {
-    return (c >= 32 && c <= 126) ? 1 : 0;
+unsigned char (isprint)(char c) {
+    return isprint(c) ? 1 : 0;
 }
 
-unsigned char ispunct(char c) {
-    return ((c >= 33 && c <= 47)  ||
-            (c >= 58 && c <= 64)  ||
-            (c >= 91 && c <= 96)  ||
-            (c >= 123 && c <= 126)) ? 1 : 0;
+unsigned char (ispunct)(char c) {
+    return ispunct(c) ? 1 : 0;
 }
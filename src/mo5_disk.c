@@ -0,0 +1,215 @@
+/**
+ * @file
+ * @brief On-demand file loading from floppy — implémentation.
+ *
+ * Les secteurs pleins sont lus directement à destination, comme le fait
+ * le boot loader : le 256e octet (inutilisé) déborde sur le premier octet
+ * du secteur suivant, qui l'écrase. Le dernier secteur passe par le
+ * buffer interne pour ne rien écrire au-delà de la fin du fichier.
+ *
+ * Chaque segment est lu dans l'ordre d'entrelacement de la table : les
+ * données consécutives du fichier sont dans des secteurs espacés de
+ * `interleave`, le temps de traiter un secteur avant que le suivant
+ * passe sous la tête.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_disk.h"
+
+// ============================================================================
+// ÉTAT INTERNE
+// ============================================================================
+
+static unsigned char  disk_drive;
+static unsigned char  disk_buf[MO5_DISK_SECTOR_SIZE];
+
+/* Ordre de lecture d'une piste : position (0-15) -> secteur (1-16) */
+static unsigned char  disk_order[MO5_DISK_TRACK_SECTORS];
+static unsigned char  disk_order_k;
+
+/* Lecteur d'octets séquentiel sur la table des overlays */
+static unsigned char  table_sector;
+static unsigned int   table_pos;
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/* Octet suivant de la table (charge le secteur suivant si besoin). */
+static unsigned char table_next(unsigned char *err)
+{
+    if (table_pos == MO5_DISK_SECTOR_SIZE) {
+        if (table_sector == MO5_DISK_TABLE_LAST
+         || mo5_disk_read_sector(MO5_DISK_TABLE_TRACK, ++table_sector, disk_buf) != MO5_DISK_OK) {
+            *err = 1;
+            return 0xFF;
+        }
+        table_pos = 0;
+    }
+    return disk_buf[table_pos++];
+}
+
+/* Calcule disk_order pour un entrelacement k (même calcul que makefd.py). */
+static void disk_order_init(unsigned char k)
+{
+    unsigned char used[MO5_DISK_TRACK_SECTORS];
+    unsigned char pos = 0;
+    unsigned char i;
+
+    if (k == disk_order_k)
+        return;
+    disk_order_k = k;
+
+    for (i = 0; i < MO5_DISK_TRACK_SECTORS; i++) used[i] = 0;
+
+    for (i = 0; i < MO5_DISK_TRACK_SECTORS; i++) {
+        while (used[pos])
+            pos = (pos + 1) & (MO5_DISK_TRACK_SECTORS - 1);
+        used[pos]     = 1;
+        disk_order[i] = pos + 1;
+        pos = (pos + k) & (MO5_DISK_TRACK_SECTORS - 1);
+    }
+}
+
+/* Convertit "level1.dat" en nom Thomson 8+3 en majuscules complété d'espaces. */
+static void disk_name(const char *name, char *out)
+{
+    unsigned char i;
+    char          c;
+
+    for (i = 0; i < 11; i++) out[i] = ' ';
+
+    for (i = 0; *name && *name != '.'; name++)
+        if (i < 8) out[i++] = *name;
+    if (*name == '.') name++;
+    for (i = 8; *name; name++)
+        if (i < 11) out[i++] = *name;
+
+    for (i = 0; i < 11; i++) {
+        c = out[i];
+        if (c >= 'a' && c <= 'z') out[i] = c - ('a' - 'A');
+    }
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_disk_set_drive(unsigned char drive)
+{
+    disk_drive = drive;
+}
+
+unsigned char mo5_disk_read_sector(unsigned char track, unsigned char sector,
+                                   unsigned char *buf)
+{
+    unsigned char err;
+
+    *DK_DRV = disk_drive;
+    *DK_TRK = track;            /* 16 bits : efface aussi l'octet haut en $204A */
+    *DK_SEC = sector;
+    *DK_BUF = buf;
+    *DK_OPC = MO5_DK_READ;
+
+    /* DKCO : carry positionné en cas d'erreur */
+    asm {
+        swi
+        fcb $26
+        clra
+        rola
+        sta err
+    }
+
+    return err ? MO5_DISK_IO_ERROR : MO5_DISK_OK;
+}
+
+unsigned char mo5_disk_find(const char *name, MO5_DiskFile *file)
+{
+    char          wanted[11];
+    unsigned char interleave;
+    unsigned char match;
+    unsigned char err = 0;
+    unsigned char i;
+    unsigned char n;
+
+    disk_name(name, wanted);
+
+    table_sector = MO5_DISK_TABLE_SECTOR;
+    table_pos    = 0;
+    if (mo5_disk_read_sector(MO5_DISK_TABLE_TRACK, table_sector, disk_buf) != MO5_DISK_OK)
+        return MO5_DISK_IO_ERROR;
+
+    interleave = table_next(&err);
+    if (interleave == 0 || interleave >= MO5_DISK_TRACK_SECTORS)
+        return MO5_DISK_IO_ERROR;           /* table absente ou étrangère */
+
+    for (;;) {
+        match = 1;
+        for (i = 0; i < 11; i++) {
+            n = table_next(&err);
+            if (err) return MO5_DISK_IO_ERROR;
+            if (i == 0 && n == 0xFF) return MO5_DISK_NOT_FOUND;
+            if (n != (unsigned char)wanted[i]) match = 0;
+        }
+
+        file->size       = (unsigned int)table_next(&err) << 8;
+        file->size      |= table_next(&err);
+        file->interleave = interleave;
+        file->run_count  = table_next(&err);
+        if (err || file->run_count > MO5_DISK_MAX_RUNS)
+            return MO5_DISK_IO_ERROR;
+
+        for (n = 0; n < file->run_count; n++) {
+            for (i = 0; i < 3; i++)
+                file->runs[n][i] = table_next(&err);
+        }
+
+        if (err) return MO5_DISK_IO_ERROR;
+        if (match) return MO5_DISK_OK;
+    }
+}
+
+unsigned char mo5_disk_load_file(const MO5_DiskFile *file, unsigned char *dst)
+{
+    unsigned int  left = file->size;
+    unsigned char r;
+    unsigned char p;
+    unsigned char s;
+    unsigned char n;
+
+    disk_order_init(file->interleave);
+
+    for (r = 0; r < file->run_count && left; r++) {
+        for (p = file->runs[r][1]; p <= file->runs[r][2] && left; p++) {
+            s = disk_order[p - 1];
+            if (left > MO5_DISK_SECTOR_DATA) {
+                if (mo5_disk_read_sector(file->runs[r][0], s, dst) != MO5_DISK_OK)
+                    return MO5_DISK_IO_ERROR;
+                dst  += MO5_DISK_SECTOR_DATA;
+                left -= MO5_DISK_SECTOR_DATA;
+            } else {
+                /* Dernier secteur : copie exacte depuis le buffer */
+                if (mo5_disk_read_sector(file->runs[r][0], s, disk_buf) != MO5_DISK_OK)
+                    return MO5_DISK_IO_ERROR;
+                for (n = 0; n < (unsigned char)left; n++)
+                    dst[n] = disk_buf[n];
+                left = 0;
+            }
+        }
+    }
+
+    return MO5_DISK_OK;
+}
+
+unsigned char mo5_disk_load(const char *name, unsigned char *dst)
+{
+    static MO5_DiskFile file;
+    unsigned char       status;
+
+    status = mo5_disk_find(name, &file);
+    if (status != MO5_DISK_OK)
+        return status;
+    return mo5_disk_load_file(&file, dst);
+}
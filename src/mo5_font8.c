@@ -8,6 +8,7 @@
 
 #include "mo5_font8.h"
 #include <mo5_sprite_bg.h>
+#include "mo5_ctype.h"
 
 /* =========================================================================
  * BITMAPS DE LA POLICE  (prives a cette unite de compilation)
@@ -75,9 +76,13 @@ static unsigned char *font8_nums[] = {
 
 static unsigned char *font8_get(char c)
 {
-    if (c >= 'A' && c <= 'Z') return font8_alpha[c - 'A'];
-    if (c >= 'a' && c <= 'z') return font8_alpha[c - 'a'];
-    if (c >= '0' && c <= '9') return font8_nums[c - '0'];
+    /* Une seule lecture de table classe le caractere */
+    unsigned char ct = mo5_ctype_table[(unsigned char)c];
+
+    if (ct & MO5_CT_UPPER)    return font8_alpha[c - 'A'];
+    if (ct & MO5_CT_LOWER)    return font8_alpha[c - 'a'];
+    if (ct & MO5_CT_DIGIT)    return font8_nums[c - '0'];
+    if (!(ct & MO5_CT_PUNCT)) return f_SPACE;
     if (c == '.')              return f_DOT;
     if (c == '!')              return f_EXCL;
     if (c == ':')              return f_COLON;
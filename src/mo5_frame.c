@@ -0,0 +1,135 @@
+/**
+ * @file
+ * @brief Frame-time instrumentation — implémentation.
+ *
+ * Détection des overruns :
+ *   mo5_wait_vbl() compare mo5_frame_vbl à sa valeur à la sortie précédente.
+ *   Deux sorties sont séparées par un nombre entier de trames, et l'IRQ
+ *   50 Hz tombe une fois par trame quelle que soit sa phase : le compteur
+ *   a avancé de 1 si la frame a tenu, de 2 ou plus si un VBL a été manqué.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_frame.h"
+
+MO5_FrameStats        mo5_frame_stats;
+
+// ============================================================================
+// ÉTAT INTERNE
+// ============================================================================
+
+static unsigned int   frame_seen_vbl;     // mo5_frame_vbl en sortie du dernier wait
+static unsigned char  frame_raster_on;
+static unsigned char  frame_busy_color;
+static unsigned char  frame_idle_color;
+static unsigned char  frame_hooked;       // tick démarré par mo5_frame_init
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_frame_init(void)
+{
+    mo5_frame_reset();
+    mo5_frame_calibrate();
+
+    if (frame_hooked)
+        return;
+
+    mo5_tick_init();
+    frame_seen_vbl = mo5_frame_vbl;
+    frame_hooked   = 1;
+}
+
+void mo5_frame_shutdown(void)
+{
+    if (!frame_hooked)
+        return;
+
+    mo5_tick_shutdown();
+    frame_hooked = 0;
+}
+
+void mo5_frame_reset(void)
+{
+    mo5_frame_stats.frames         = 0;
+    mo5_frame_stats.overruns       = 0;
+    mo5_frame_stats.idle_spins     = 0;
+    mo5_frame_stats.min_idle_spins = 0xFFFF;
+}
+
+void mo5_frame_calibrate(void)
+{
+    /* Le 2e wait démarre juste après un début de trame : il mesure une trame vide */
+    mo5_wait_vbl();
+    mo5_wait_vbl();
+    mo5_frame_stats.full_spins = mo5_frame_stats.idle_spins;
+}
+
+unsigned char mo5_frame_load(void)
+{
+    unsigned int unit;
+    unsigned int idle;
+
+    unit = mo5_frame_stats.full_spins / 100;
+    if (unit == 0)
+        return 0;
+
+    idle = mo5_frame_stats.idle_spins / unit;
+    if (idle > 100)
+        idle = 100;
+
+    return (unsigned char)(100 - idle);
+}
+
+void mo5_frame_raster(unsigned char busy_color, unsigned char idle_color)
+{
+    frame_busy_color = busy_color;
+    frame_idle_color = idle_color;
+    frame_raster_on  = 1;
+}
+
+void mo5_frame_raster_off(void)
+{
+    frame_raster_on = 0;
+}
+
+// ============================================================================
+// INTERNE — appelé par mo5_wait_vbl()
+// ============================================================================
+
+void mo5_frame_wait_begin(void)
+{
+    if (frame_raster_on)
+        mo5_set_border(frame_idle_color);
+}
+
+void mo5_frame_resync(void)
+{
+    frame_seen_vbl = mo5_frame_vbl;
+}
+
+void mo5_frame_wait_end(unsigned int spins)
+{
+    unsigned int vbl = mo5_frame_vbl;
+    unsigned int elapsed;
+
+    if (frame_raster_on)
+        mo5_set_border(frame_busy_color);
+
+    elapsed        = vbl - frame_seen_vbl;
+    frame_seen_vbl = vbl;
+    mo5_frame_stats.frames++;
+
+    /* Frame en retard : l'attente mesurée est la trame perdue, pas du temps libre */
+    if (elapsed >= 2) {
+        mo5_frame_stats.overruns++;
+        spins = 0;
+    }
+
+    mo5_frame_stats.idle_spins = spins;
+    if (spins < mo5_frame_stats.min_idle_spins)
+        mo5_frame_stats.min_idle_spins = spins;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file
+ * @brief Non-blocking line editor — implémentation.
+ *
+ * Les touches modifient buf et élargissent l'intervalle de cases à
+ * redessiner [dirty_from, dirty_to] ; mo5_lineedit_draw ne redessine que
+ * ces cases. Une case = clear de la forme (1 octet x hauteur de police),
+ * puis le caractère, puis le curseur '_' s'il est sur cette case.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_lineedit.h"
+#include "mo5_ctype.h"
+#include "mo5_sprite_bg.h"
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/* Ajoute les cases [from, to] à l'intervalle à redessiner. */
+static void le_mark(MO5_LineEdit *ed, unsigned char from, unsigned char to)
+{
+    if (ed->dirty_from > ed->dirty_to) {
+        ed->dirty_from = from;
+        ed->dirty_to   = to;
+        return;
+    }
+    if (from < ed->dirty_from) ed->dirty_from = from;
+    if (to   > ed->dirty_to)   ed->dirty_to   = to;
+}
+
+/* Déplace le curseur : ancienne et nouvelle case à redessiner, curseur
+   visible tout de suite. */
+static void le_move(MO5_LineEdit *ed, unsigned char pos)
+{
+    le_mark(ed, ed->cursor, ed->cursor);
+    le_mark(ed, pos, pos);
+    ed->cursor = pos;
+    ed->blink  = 0;
+}
+
+/* Redessine la case i. */
+static void le_cell(const MO5_LineEdit *ed, unsigned char i)
+{
+    unsigned char tx = ed->tx + i;
+    char          s[2];
+
+    /* Les polices dessinent en |= : la forme de la case est d'abord remise à 0 */
+    mo5_clear_sprite_bg(tx, ed->ty, 1, ed->font->height);
+
+    s[1] = '\0';
+    if (i < ed->len) {
+        s[0] = ed->buf[i];
+        ed->font->puts(tx, ed->ty, s, ed->color);
+    }
+    if (i == ed->cursor && !ed->done && !(ed->blink & MO5_LE_BLINK)) {
+        s[0] = '_';
+        ed->font->puts(tx, ed->ty, s, ed->color);
+    }
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_lineedit_init(MO5_LineEdit *ed, char *buf, unsigned char max_len,
+                       unsigned char tx, unsigned char ty,
+                       const MO5_LineEditFont *font, unsigned char color)
+{
+    ed->buf        = buf;
+    ed->font       = font;
+    ed->max_len    = max_len;
+    ed->len        = 0;
+    ed->cursor     = 0;
+    ed->tx         = tx;
+    ed->ty         = ty;
+    ed->color      = color;
+    ed->dirty_from = 0;
+    ed->dirty_to   = max_len;
+    ed->blink      = 0;
+    ed->done       = 0;
+
+    buf[0] = '\0';
+}
+
+unsigned char mo5_lineedit_key(MO5_LineEdit *ed, char key)
+{
+    unsigned char i;
+
+    if (ed->done)
+        return MO5_LE_DONE;
+
+    switch (key) {
+    case 0:
+        break;
+
+    case MO5_ENTER_CHAR:
+        ed->done = 1;
+        le_mark(ed, ed->cursor, ed->cursor);    /* efface le curseur */
+        return MO5_LE_DONE;
+
+    case MO5_KEY_LEFT:
+        if (ed->cursor > 0) le_move(ed, ed->cursor - 1);
+        break;
+
+    case MO5_KEY_RIGHT:
+        if (ed->cursor < ed->len) le_move(ed, ed->cursor + 1);
+        break;
+
+    case MO5_KEY_UP:
+        le_move(ed, 0);
+        break;
+
+    case MO5_KEY_DOWN:
+        le_move(ed, ed->len);
+        break;
+
+    case MO5_KEY_DEL:
+        if (ed->cursor == 0)
+            break;
+        /* Décale la fin de ligne d'un cran vers la gauche (terminateur compris) */
+        for (i = ed->cursor - 1; i < ed->len; i++)
+            ed->buf[i] = ed->buf[i + 1];
+        le_mark(ed, ed->cursor - 1, ed->len);   /* l'ancienne dernière case devient vide */
+        ed->len--;
+        ed->cursor--;
+        ed->blink = 0;
+        break;
+
+    default:
+        if (!isprint(key) || ed->len >= ed->max_len)
+            break;
+        /* Décale la fin de ligne d'un cran vers la droite (terminateur compris) */
+        for (i = ed->len + 1; i > ed->cursor; i--)
+            ed->buf[i] = ed->buf[i - 1];
+        ed->buf[ed->cursor] = key;
+        ed->len++;
+        le_mark(ed, ed->cursor, ed->len);
+        ed->cursor++;
+        ed->blink = 0;
+        break;
+    }
+
+    return MO5_LE_EDITING;
+}
+
+unsigned char mo5_lineedit_poll(MO5_LineEdit *ed)
+{
+    return mo5_lineedit_key(ed, mo5_getchar());
+}
+
+void mo5_lineedit_draw(MO5_LineEdit *ed)
+{
+    unsigned char i;
+
+    /* Clignotement : la case du curseur change d'état toutes les MO5_LE_BLINK frames */
+    ed->blink++;
+    if (!ed->done && (ed->blink & (MO5_LE_BLINK - 1)) == 0)
+        le_mark(ed, ed->cursor, ed->cursor);
+
+    if (ed->dirty_from > ed->dirty_to)
+        return;
+
+    for (i = ed->dirty_from; i <= ed->dirty_to; i++)
+        le_cell(ed, i);
+
+    ed->dirty_from = 1;
+    ed->dirty_to   = 0;
+}
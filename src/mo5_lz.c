@@ -0,0 +1,77 @@
+/**
+ * @file
+ * @brief LZ decompressor — implémentation.
+ *
+ * Copie octet par octet pour les références : un offset inférieur à la
+ * longueur relit les octets tout juste écrits (répétition façon RLE).
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_lz.h"
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+unsigned int mo5_lz_unpack(const unsigned char *src, unsigned char *dst)
+{
+    unsigned int   size = MO5_LZ_SIZE(src);
+    unsigned char *end  = dst + size;
+    unsigned char *ref;
+    unsigned char  c;
+    unsigned char  n;
+
+    src += 2;
+    while (dst < end) {
+        c = *src++;
+
+        if (c & 0x80) {
+            /* Référence arrière : 3..130 octets */
+            n    = (c & 0x7F) + 3;
+            ref  = dst - (((unsigned int)src[0] << 8) | src[1]);
+            src += 2;
+            while (n--) *dst++ = *ref++;
+        } else {
+            /* Littéraux : 1..128 octets */
+            n = c + 1;
+            while (n--) *dst++ = *src++;
+        }
+    }
+
+    return size;
+}
+
+void mo5_lz_unpack_screen(const unsigned char *form_lz, const unsigned char *color_lz)
+{
+    *PRC &= ~0x01;
+    mo5_lz_unpack(color_lz, VRAM);
+
+    *PRC |= 0x01;
+    mo5_lz_unpack(form_lz, VRAM);
+}
+
+unsigned char mo5_lz_unpack_sprite(MO5_Arena *arena, const MO5_PackedSprite *packed,
+                                   MO5_Sprite *out)
+{
+    MO5_ArenaMark  mark = mo5_arena_mark(arena);
+    unsigned char *form;
+    unsigned char *color;
+
+    form  = (unsigned char *)mo5_arena_alloc(arena, MO5_LZ_SIZE(packed->form_lz));
+    color = (unsigned char *)mo5_arena_alloc(arena, MO5_LZ_SIZE(packed->color_lz));
+    if (form == NULL || color == NULL) {
+        mo5_arena_release(arena, mark);
+        return 0;
+    }
+
+    mo5_lz_unpack(packed->form_lz,  form);
+    mo5_lz_unpack(packed->color_lz, color);
+
+    out->form        = form;
+    out->color       = color;
+    out->width_bytes = packed->width_bytes;
+    out->height      = packed->height;
+    return 1;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file
+ * @brief Fixed-capacity object pool — implémentation.
+ *
+ * Un slot libre contient, dans ses 2 premiers octets, l'adresse du slot
+ * libre suivant. La liste libre ne coûte donc aucun octet supplémentaire.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_pool.h"
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_pool_init(MO5_Pool *pool, void *storage, unsigned int slot_size,
+                   unsigned char capacity, void **live)
+{
+    pool->storage   = (unsigned char *)storage;
+    pool->live      = live;
+    pool->slot_size = slot_size;
+    pool->capacity  = capacity;
+
+    mo5_pool_clear(pool);
+}
+
+void *mo5_pool_alloc(MO5_Pool *pool)
+{
+    unsigned char *slot = pool->free_head;
+
+    if (slot == NULL)
+        return NULL;
+
+    pool->free_head = *(unsigned char **)slot;
+    pool->live[pool->count++] = slot;
+    return slot;
+}
+
+void mo5_pool_free(MO5_Pool *pool, unsigned char index)
+{
+    unsigned char *slot = (unsigned char *)pool->live[index];
+
+    /* Swap-remove : le dernier vivant prend la place libérée */
+    pool->live[index] = pool->live[--pool->count];
+
+    *(unsigned char **)slot = pool->free_head;
+    pool->free_head = slot;
+}
+
+void mo5_pool_clear(MO5_Pool *pool)
+{
+    unsigned char *slot = pool->storage;
+    unsigned char  n    = pool->capacity;
+
+    /* Chaînage dans l'ordre du stockage : alloc rend les slots 0, 1, 2... */
+    pool->free_head = slot;
+    while (--n) {
+        *(unsigned char **)slot = slot + pool->slot_size;
+        slot += pool->slot_size;
+    }
+    *(unsigned char **)slot = NULL;
+
+    pool->count = 0;
+}
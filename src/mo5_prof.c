@@ -0,0 +1,231 @@
+/**
+ * @file
+ * @brief Named profiling zones — implémentation.
+ *
+ * Mesure par sondage : au BEGIN de la zone sondée, on se cale sur le début
+ * d'une trame ; au END, on compte les spins restants jusqu'à la trame
+ * suivante. Coût = spins d'une trame vide - spins restants.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_prof.h"
+#include "mo5_font6.h"
+#include "mo5_stdio.h"
+#include "mo5_string.h"
+
+#define PROF_LINE_LEN  26   // 8 (nom) + 3 x 6 (nombres)
+
+MO5_ProfZone mo5_prof_zones[MO5_PROF_MAX_ZONES];
+
+// ============================================================================
+// ÉTAT INTERNE
+// ============================================================================
+
+static unsigned char prof_probe;        // zone sondée au prochain passage
+static unsigned char prof_active;       // 1 pendant l'exécution de la zone sondée
+static unsigned int  prof_last_frame;   // frame du dernier sondage
+static unsigned int  prof_vbl;          // mo5_frame_vbl au BEGIN sondé
+static unsigned int  prof_full;         // spins d'une trame vide
+static unsigned int  prof_cps;          // cycles par spin
+
+static char          prof_line[PROF_LINE_LEN + 1];
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/*
+ * Attend le prochain début de trame en comptant les tours de boucle.
+ * Même boucle que mo5_wait_vbl() : même coût par spin.
+ */
+static unsigned int prof_spin_to_vbl(void)
+{
+    unsigned int spins;
+
+    spins = 0;
+    while ( *VBL_REG &  VBL_BIT) spins++;
+    while (!(*VBL_REG & VBL_BIT)) spins++;
+    return spins;
+}
+
+/* Passe à la zone déclarée suivante (round-robin). */
+static void prof_next_probe(void)
+{
+    unsigned char n = MO5_PROF_MAX_ZONES;
+
+    while (n--) {
+        prof_probe++;
+        if (prof_probe >= MO5_PROF_MAX_ZONES) prof_probe = 0;
+        if (mo5_prof_zones[prof_probe].name) return;
+    }
+}
+
+static void prof_record(MO5_ProfZone *z, unsigned int cost)
+{
+    z->last = cost;
+    if (cost > z->max) z->max = cost;
+
+    if (z->samples == 0) z->avg = cost;
+    else                 z->avg = z->avg - (z->avg >> 3) + (cost >> 3);
+
+    if (z->samples < 255) z->samples++;
+    if (z->budget && cost > z->budget && z->over < 255) z->over++;
+}
+
+/* Copie s dans p, complété par des espaces jusqu'à width caractères. */
+static char *prof_put_str(char *p, const char *s, unsigned char width)
+{
+    while (width && *s) { *p++ = *s++; width--; }
+    while (width--) *p++ = ' ';
+    return p;
+}
+
+/* Écrit v aligné à droite sur 6 caractères. */
+static char *prof_put_num(char *p, unsigned int v)
+{
+    char          digits[6];
+    unsigned char len;
+
+    utoa10(v, digits);
+    len = (unsigned char)mo5_strlen(digits);
+    p = prof_put_str(p, "", 6 - len);
+    return prof_put_str(p, digits, len);
+}
+
+static void prof_format_header(void)
+{
+    char *p = prof_line;
+
+    p = prof_put_str(p, "ZONE",   8);
+    p = prof_put_str(p, "  LAST", 6);
+    p = prof_put_str(p, "   MAX", 6);
+    p = prof_put_str(p, "BUDGET", 6);
+    *p = '\0';
+}
+
+static void prof_format_zone(const MO5_ProfZone *z)
+{
+    char *p = prof_line;
+
+    p = prof_put_str(p, z->name, 8);
+    p = prof_put_num(p, z->last);
+    p = prof_put_num(p, z->max);
+    p = prof_put_num(p, z->budget);
+    *p = '\0';
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_prof_init(void)
+{
+    MO5_ProfZone *z = mo5_prof_zones;
+    unsigned char n = MO5_PROF_MAX_ZONES;
+
+    while (n--) {
+        z->name    = NULL;
+        z->budget  = 0;
+        z->last    = 0;
+        z->max     = 0;
+        z->avg     = 0;
+        z->samples = 0;
+        z->over    = 0;
+        z++;
+    }
+
+    prof_spin_to_vbl();
+    prof_full = prof_spin_to_vbl();
+    mo5_frame_resync();
+    prof_cps  = prof_full ? MO5_FRAME_CYCLES / prof_full : 0;
+
+    prof_probe      = 0;
+    prof_active     = 0;
+    prof_last_frame = mo5_frame_stats.frames;
+}
+
+void mo5_prof_zone(unsigned char id, const char *name, unsigned int budget)
+{
+    mo5_prof_zones[id].name   = name;
+    mo5_prof_zones[id].budget = budget;
+
+    if (!mo5_prof_zones[prof_probe].name) prof_probe = id;
+}
+
+void mo5_prof_begin(unsigned char id)
+{
+    if (id != prof_probe || prof_active)
+        return;
+    if ((unsigned int)(mo5_frame_stats.frames - prof_last_frame) < MO5_PROF_PERIOD)
+        return;
+
+    prof_spin_to_vbl();             /* t = 0 : début de trame */
+    mo5_frame_resync();             /* VBL voulu : pas un overrun du jeu */
+    prof_vbl    = mo5_frame_vbl;
+    prof_active = 1;
+}
+
+void mo5_prof_end(unsigned char id)
+{
+    unsigned int spins;
+    unsigned int cost;
+
+    if (!prof_active || id != prof_probe)
+        return;
+
+    if (mo5_frame_vbl != prof_vbl) {
+        /* La zone a franchi un VBL : plus longue qu'une trame */
+        cost = MO5_PROF_OVERFLOW;
+    } else {
+        spins = prof_spin_to_vbl();
+        mo5_frame_resync();
+        cost  = (spins < prof_full) ? (prof_full - spins) * prof_cps : 0;
+    }
+
+    prof_record(&mo5_prof_zones[id], cost);
+
+    prof_active     = 0;
+    prof_last_frame = mo5_frame_stats.frames;
+    prof_next_probe();
+}
+
+void mo5_prof_dump(unsigned char tx, unsigned char ty)
+{
+    const MO5_ProfZone *z = mo5_prof_zones;
+    unsigned char       n = MO5_PROF_MAX_ZONES;
+    unsigned char       fg;
+
+    prof_format_header();
+    mo5_font6_clear(tx, ty, PROF_LINE_LEN);
+    mo5_font6_puts(tx, ty, prof_line, C_WHITE);
+
+    while (n--) {
+        if (z->name) {
+            ty += 6;
+            fg = (z->budget && z->last > z->budget) ? C_LIGHT_RED : C_WHITE;
+            prof_format_zone(z);
+            mo5_font6_clear(tx, ty, PROF_LINE_LEN);
+            mo5_font6_puts(tx, ty, prof_line, fg);
+        }
+        z++;
+    }
+}
+
+void mo5_prof_print(void)
+{
+    const MO5_ProfZone *z = mo5_prof_zones;
+    unsigned char       n = MO5_PROF_MAX_ZONES;
+
+    prof_format_header();
+    puts(prof_line);
+
+    while (n--) {
+        if (z->name) {
+            prof_format_zone(z);
+            puts(prof_line);
+        }
+        z++;
+    }
+}
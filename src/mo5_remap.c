@@ -0,0 +1,213 @@
+/**
+ * @file
+ * @brief Color-bank effects — implémentation.
+ *
+ * Boucle d'application, 8 octets par tour (Y = table + 128) :
+ *
+ *   LDD  n,U          2 octets source
+ *   LDA  A,Y          remap de l'octet haut
+ *   LDB  B,Y          remap de l'octet bas
+ *   STD  n,X          ~22 cycles les 2 octets, x 4, + 19 de boucle
+ *
+ * En place, U = X. Quand le rectangle fait toute la largeur de l'écran,
+ * ses lignes sont contiguës : 6 lignes (240 octets) par appel.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_remap.h"
+#include "mo5_video.h"
+#include "mo5_string.h"
+
+// ============================================================================
+// ÉTAT INTERNE
+// ============================================================================
+
+/* Couleur suivante d'un fondu au noir : claire -> de base -> noir. */
+static const unsigned char remap_darker[16] = {
+    C_BLACK,        // noir
+    C_BLACK,        // rouge
+    C_BLACK,        // vert
+    C_ORANGE,       // jaune
+    C_BLACK,        // bleu
+    C_BLACK,        // magenta
+    C_BLACK,        // cyan
+    C_GRAY,         // blanc
+    C_BLACK,        // gris
+    C_RED,          // rouge clair
+    C_GREEN,        // vert clair
+    C_YELLOW,       // jaune clair
+    C_BLUE,         // bleu clair
+    C_MAGENTA,      // violet
+    C_CYAN,         // cyan clair
+    C_RED           // orange
+};
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/* dst[i] = map[src[i]] pour i < n ; src peut être égal à dst. */
+static void remap_span(unsigned char *dst, const unsigned char *src,
+                       unsigned char n, const unsigned char *map)
+{
+    asm {
+        pshs    u,y
+        ldx     dst
+        ldy     map
+        leay    128,y           /* LDB B,Y : décalage signé */
+        ldb     n
+        tfr     b,a
+        lsra
+        lsra
+        lsra
+        pshs    a               /* blocs de 8 octets */
+        andb    #7
+        ldu     src             /* dernier accès aux variables C */
+        tstb
+        beq     remap_blocks
+remap_byte:
+        lda     ,u+
+        lda     a,y
+        sta     ,x+
+        decb
+        bne     remap_byte
+remap_blocks:
+        tst     ,s
+        beq     remap_done
+remap_block:
+        ldd     ,u
+        lda     a,y
+        ldb     b,y
+        std     ,x
+        ldd     2,u
+        lda     a,y
+        ldb     b,y
+        std     2,x
+        ldd     4,u
+        lda     a,y
+        ldb     b,y
+        std     4,x
+        ldd     6,u
+        lda     a,y
+        ldb     b,y
+        std     6,x
+        leau    8,u
+        leax    8,x
+        dec     ,s
+        bne     remap_block
+remap_done:
+        leas    1,s
+        puls    u,y
+    }
+}
+
+/* Applique map au rectangle, depuis src (w * h octets) ou en place si src est NULL. */
+static void remap_region(const unsigned char *map, const unsigned char *src,
+                         unsigned char tx, unsigned char ty,
+                         unsigned char w,  unsigned char h)
+{
+    unsigned char *dst  = VRAM_ADDR(tx, ty);
+    unsigned char  step = (w == SCREEN_WIDTH_BYTES) ? 6 : 1;
+    unsigned char  rows;
+
+    *PRC &= ~0x01;
+    while (h) {
+        rows = (h < step) ? h : step;
+        remap_span(dst, src ? src : dst, rows * w, map);
+        dst += rows * SCREEN_WIDTH_BYTES;
+        if (src) src += rows * w;
+        h -= rows;
+    }
+    *PRC |= 0x01;
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_remap_nibbles(unsigned char *map,
+                       const unsigned char *fg, const unsigned char *bg)
+{
+    unsigned char *p = map + 0x80;      /* octet 0x00 : index 0x80 */
+    unsigned char  hi;
+    unsigned char  lo;
+    unsigned char  f;
+
+    for (hi = 0; hi < 16; hi++) {
+        if (hi == 8)
+            p = map;                    /* octet 0x80 : index 0x00 */
+        f = (unsigned char)(fg[hi] << 4);
+        for (lo = 0; lo < 16; lo++)
+            *p++ = f | bg[lo];
+    }
+}
+
+void mo5_remap_fade(unsigned char *map, unsigned char step)
+{
+    unsigned char nib[16];
+    unsigned char c;
+    unsigned char i;
+
+    for (c = 0; c < 16; c++) {
+        nib[c] = c;
+        for (i = 0; i < step; i++)
+            nib[c] = remap_darker[nib[c]];
+    }
+    mo5_remap_nibbles(map, nib, nib);
+}
+
+void mo5_remap_flash(unsigned char *map, unsigned char color)
+{
+    mo5_memset(map, COLOR(color, color), MO5_REMAP_SIZE);
+}
+
+void mo5_remap_cycle(unsigned char *map, const unsigned char *colors,
+                     unsigned char count, unsigned char phase)
+{
+    unsigned char nib[16];
+    unsigned char i;
+    unsigned char j;
+
+    for (i = 0; i < 16; i++)
+        nib[i] = i;
+
+    if (count) {
+        j = phase % count;
+        for (i = 0; i < count; i++) {
+            nib[colors[i] & 0x0F] = colors[j] & 0x0F;
+            if (++j == count) j = 0;
+        }
+    }
+    mo5_remap_nibbles(map, nib, nib);
+}
+
+void mo5_remap_rect(const unsigned char *map,
+                    unsigned char tx, unsigned char ty,
+                    unsigned char w,  unsigned char h)
+{
+    remap_region(map, NULL, tx, ty, w, h);
+}
+
+void mo5_remap_copy(const unsigned char *map, const unsigned char *src,
+                    unsigned char tx, unsigned char ty,
+                    unsigned char w,  unsigned char h)
+{
+    remap_region(map, src, tx, ty, w, h);
+}
+
+void mo5_remap_save(unsigned char *dst,
+                    unsigned char tx, unsigned char ty,
+                    unsigned char w,  unsigned char h)
+{
+    unsigned char *row = VRAM_ADDR(tx, ty);
+
+    *PRC &= ~0x01;
+    while (h--) {
+        mo5_memcpy(dst, row, w);
+        dst += w;
+        row += SCREEN_WIDTH_BYTES;
+    }
+    *PRC |= 0x01;
+}
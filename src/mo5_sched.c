@@ -0,0 +1,135 @@
+/**
+ * @file
+ * @brief Cooperative scheduler — implémentation.
+ *
+ * Budget en pas par frame, ajusté à chaque mo5_sched_run (AIMD) :
+ *   overrun depuis le run précédent  → budget / 2 (au moins 1)
+ *   charge de la frame < cible        → budget + 1, seulement si le run
+ *                                       précédent a épuisé son budget
+ *                                       et si mo5_frame est calibré
+ * La charge vient de mo5_frame_load() (temps libre mesuré par
+ * mo5_wait_vbl), les overruns de mo5_frame_stats (tick 50 Hz).
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include <cmoc.h>
+#include "mo5_sched.h"
+
+// ============================================================================
+// ÉTAT INTERNE
+// ============================================================================
+
+static MO5_Task      *sched_tasks[MO5_SCHED_MAX_TASKS];
+static unsigned char  sched_next;                 // prochaine tâche (tourniquet)
+static unsigned char  sched_budget   = 1;
+static unsigned char  sched_target   = 85;
+static unsigned int   sched_overruns;             // overruns vus au run précédent
+static unsigned char  sched_last_steps;           // pas exécutés au run précédent
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+static void sched_adapt(void)
+{
+    if (mo5_frame_stats.overruns != sched_overruns) {
+        sched_overruns = mo5_frame_stats.overruns;
+        sched_budget >>= 1;
+        if (sched_budget == 0)
+            sched_budget = 1;
+        return;
+    }
+
+    /* Sans calibrage, mo5_frame_load() vaut 0 : pas de mesure, pas de hausse */
+    if (mo5_frame_stats.full_spins == 0)
+        return;
+
+    /* Un budget non épuisé n'a rien limité : la charge ne dit rien de plus */
+    if (sched_last_steps == sched_budget
+        && mo5_frame_load() < sched_target
+        && sched_budget < MO5_SCHED_MAX_BUDGET)
+        sched_budget++;
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+unsigned char mo5_sched_add(MO5_Task *task, MO5_TaskFn fn, void *ctx)
+{
+    unsigned char i;
+
+    for (i = 0; i < MO5_SCHED_MAX_TASKS; i++) {
+        if (sched_tasks[i] == NULL) {
+            task->fn       = fn;
+            task->ctx      = ctx;
+            task->resume   = 0;
+            task->done     = 0;
+            sched_tasks[i] = task;
+            return i;
+        }
+    }
+    return MO5_SCHED_FULL;
+}
+
+void mo5_sched_remove(MO5_Task *task)
+{
+    unsigned char i;
+
+    for (i = 0; i < MO5_SCHED_MAX_TASKS; i++)
+        if (sched_tasks[i] == task)
+            sched_tasks[i] = NULL;
+}
+
+unsigned char mo5_sched_run(void)
+{
+    unsigned char steps = 0;
+    unsigned char idle  = 0;          // emplacements vides consécutifs
+    MO5_Task     *task;
+
+    sched_adapt();
+
+    while (steps < sched_budget && idle < MO5_SCHED_MAX_TASKS) {
+        task = sched_tasks[sched_next];
+        if (++sched_next == MO5_SCHED_MAX_TASKS)
+            sched_next = 0;
+
+        if (task == NULL) {
+            idle++;
+            continue;
+        }
+
+        idle = 0;
+        steps++;
+        if (task->fn(task) == MO5_TASK_DONE) {
+            task->done = 1;
+            mo5_sched_remove(task);
+        }
+    }
+
+    sched_last_steps = steps;
+    return steps;
+}
+
+unsigned char mo5_sched_pending(void)
+{
+    unsigned char i;
+    unsigned char n = 0;
+
+    for (i = 0; i < MO5_SCHED_MAX_TASKS; i++)
+        if (sched_tasks[i])
+            n++;
+    return n;
+}
+
+unsigned char mo5_sched_budget(void)
+{
+    return sched_budget;
+}
+
+void mo5_sched_target(unsigned char load_percent)
+{
+    sched_target = load_percent;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @brief Full-screen RLE / delta images — implémentation.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_screen.h"
+
+#define OP_MASK     0xC0
+#define OP_LITERAL  0x00
+#define OP_FILL     0x40
+#define OP_SKIP     0x80
+#define OP_END      0xC0
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/* Décode un segment (une ligne d'une banque) vers dst. Retourne la suite du flux. */
+static const unsigned char *screen_segment(const unsigned char *src, unsigned char *dst)
+{
+    unsigned char *end = dst + SCREEN_WIDTH_BYTES;
+    unsigned char  c;
+    unsigned char  n;
+    unsigned char  v;
+
+    while (dst < end) {
+        c = *src++;
+        n = (c & 0x3F) + 1;
+
+        switch (c & OP_MASK) {
+        case OP_LITERAL:
+            while (n--) *dst++ = *src++;
+            break;
+        case OP_FILL:
+            v = *src++;
+            while (n--) *dst++ = v;
+            break;
+        case OP_SKIP:
+            dst += n;
+            break;
+        default:
+            /* OP_END : reste de la ligne inchangé */
+            return src;
+        }
+    }
+
+    return src;
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_screen_begin(MO5_ScreenCursor *cur, const unsigned char *stream)
+{
+    cur->src = stream;
+    cur->row = 0;
+}
+
+unsigned char mo5_screen_step(MO5_ScreenCursor *cur, unsigned char rows)
+{
+    const unsigned char *src  = cur->src;
+    unsigned char        y    = cur->row;
+    unsigned char        stop;
+    unsigned char       *line;
+    unsigned char        c;
+
+    /* Image terminée : pas de ligne 200 dans row_offsets */
+    if (y >= SCREEN_HEIGHT)
+        return 0;
+
+    stop = (y + rows > SCREEN_HEIGHT) ? SCREEN_HEIGHT : y + rows;
+    line = VRAM_ROW(y);
+
+    while (y < stop) {
+        c = *src;
+        if (c > OP_END) {
+            /* Lignes entières inchangées */
+            src++;
+            c &= 0x3F;
+            y    += c;
+            line += row_offsets[c];
+            continue;
+        }
+
+        *PRC &= ~0x01;
+        src = screen_segment(src, line);
+        *PRC |= 0x01;
+        src = screen_segment(src, line);
+
+        line += SCREEN_WIDTH_BYTES;
+        y++;
+    }
+
+    cur->src = src;
+    cur->row = y;
+    return y < SCREEN_HEIGHT;
+}
+
+void mo5_screen_draw(const unsigned char *stream)
+{
+    MO5_ScreenCursor cur;
+
+    mo5_screen_begin(&cur, stream);
+    mo5_screen_step(&cur, SCREEN_HEIGHT);
+}
@@ -0,0 +1,217 @@
+/**
+ * @file
+ * @brief Shadow-RAM compositing — implémentation.
+ *
+ * Chaque écriture dans le composite élargit l'intervalle sale [x0, x1)
+ * des lignes touchées. Le flush parcourt la table deux fois (banque
+ * couleur puis banque forme) : un seul changement de banque par flush.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_shadow.h"
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/* Marque sales les octets [lx, lx + w) des lignes [ly, ly + h) (coordonnées locales). */
+static void shadow_mark(MO5_Shadow *sh, unsigned char lx, unsigned char ly,
+                        unsigned char w, unsigned char h)
+{
+    MO5_ShadowSpan *span = sh->spans + ly;
+    unsigned char   x1   = lx + w;
+
+    while (h--) {
+        if (lx < span->x0) span->x0 = lx;
+        if (x1 > span->x1) span->x1 = x1;
+        span++;
+    }
+}
+
+/* Remet toutes les lignes à l'état propre. */
+static void shadow_reset(MO5_Shadow *sh)
+{
+    MO5_ShadowSpan *span = sh->spans;
+    unsigned char   n    = sh->h;
+
+    while (n--) {
+        span->x0 = sh->w;
+        span->x1 = 0;
+        span++;
+    }
+}
+
+/* Copie les intervalles sales de buf dans la banque VRAM courante. */
+static void shadow_copy(const MO5_Shadow *sh, const unsigned char *buf)
+{
+    const MO5_ShadowSpan *span = sh->spans;
+    const unsigned char  *src;
+    unsigned char        *dst;
+    unsigned char         r;
+    unsigned char         n;
+
+    for (r = 0; r < sh->h; r++, span++, buf += sh->w) {
+        if (span->x0 >= span->x1)
+            continue;
+
+        src = buf + span->x0;
+        dst = VRAM_ADDR(sh->x + span->x0, sh->y + r);
+        n   = span->x1 - span->x0;
+        while (n--) *dst++ = *src++;
+    }
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_shadow_init(MO5_Shadow *sh,
+                     unsigned char x, unsigned char y,
+                     unsigned char w, unsigned char h,
+                     unsigned char *form, unsigned char *color,
+                     MO5_ShadowSpan *spans)
+{
+    sh->form     = form;
+    sh->color    = color;
+    sh->bg_form  = NULL;
+    sh->bg_color = NULL;
+    sh->spans    = spans;
+    sh->x        = x;
+    sh->y        = y;
+    sh->w        = w;
+    sh->h        = h;
+
+    shadow_reset(sh);
+}
+
+void mo5_shadow_set_background(MO5_Shadow *sh,
+                               const unsigned char *bg_form,
+                               const unsigned char *bg_color)
+{
+    sh->bg_form  = bg_form;
+    sh->bg_color = bg_color;
+}
+
+void mo5_shadow_fill(MO5_Shadow *sh, unsigned char color)
+{
+    unsigned char *f = sh->form;
+    unsigned char *c = sh->color;
+    unsigned int   n = (unsigned int)sh->w * sh->h;
+
+    while (n--) {
+        *f++ = 0x00;
+        *c++ = color;
+    }
+
+    shadow_mark(sh, 0, 0, sh->w, sh->h);
+}
+
+void mo5_shadow_restore(MO5_Shadow *sh,
+                        unsigned char tx, unsigned char ty,
+                        unsigned char w,  unsigned char h)
+{
+    unsigned char        lx  = tx - sh->x;
+    unsigned char        ly  = ty - sh->y;
+    unsigned int         off;
+    unsigned char       *f;
+    unsigned char       *c;
+    const unsigned char *bf;
+    const unsigned char *bc;
+    unsigned char        rows_left = h;
+    unsigned char        col;
+
+    if (sh->bg_form == NULL)
+        return;
+
+    off = (unsigned int)ly * sh->w + lx;
+    f   = sh->form     + off;
+    c   = sh->color    + off;
+    bf  = sh->bg_form  + off;
+    bc  = sh->bg_color + off;
+
+    while (rows_left--) {
+        for (col = 0; col < w; col++) {
+            f[col] = bf[col];
+            c[col] = bc[col];
+        }
+        f  += sh->w;
+        c  += sh->w;
+        bf += sh->w;
+        bc += sh->w;
+    }
+
+    shadow_mark(sh, lx, ly, w, h);
+}
+
+void mo5_shadow_draw(MO5_Shadow *sh, unsigned char tx, unsigned char ty,
+                     const MO5_Sprite *sprite)
+{
+    unsigned char        lx  = tx - sh->x;
+    unsigned char        ly  = ty - sh->y;
+    unsigned int         off = (unsigned int)ly * sh->w + lx;
+    unsigned char       *f   = sh->form  + off;
+    unsigned char       *c   = sh->color + off;
+    const unsigned char *form_src  = sprite->form;
+    const unsigned char *color_src = sprite->color;
+    unsigned char        w   = sprite->width_bytes;
+    unsigned char        rows_left = sprite->height;
+    unsigned char        col;
+    unsigned char        fg;
+
+    while (rows_left--) {
+        for (col = 0; col < w; col++) {
+            fg = color_src[col] & 0xF0;
+            if (fg) {
+                c[col] = (c[col] & 0x0F) | fg;
+                f[col] = form_src[col];
+            }
+        }
+        f         += sh->w;
+        c         += sh->w;
+        form_src  += w;
+        color_src += w;
+    }
+
+    shadow_mark(sh, lx, ly, w, sprite->height);
+}
+
+void mo5_shadow_draw_opaque(MO5_Shadow *sh, unsigned char tx, unsigned char ty,
+                            const MO5_Sprite *sprite)
+{
+    unsigned char        lx  = tx - sh->x;
+    unsigned char        ly  = ty - sh->y;
+    unsigned int         off = (unsigned int)ly * sh->w + lx;
+    unsigned char       *f   = sh->form  + off;
+    unsigned char       *c   = sh->color + off;
+    const unsigned char *form_src  = sprite->form;
+    const unsigned char *color_src = sprite->color;
+    unsigned char        w   = sprite->width_bytes;
+    unsigned char        rows_left = sprite->height;
+    unsigned char        col;
+
+    while (rows_left--) {
+        for (col = 0; col < w; col++) {
+            f[col] = form_src[col];
+            c[col] = color_src[col];
+        }
+        f         += sh->w;
+        c         += sh->w;
+        form_src  += w;
+        color_src += w;
+    }
+
+    shadow_mark(sh, lx, ly, w, sprite->height);
+}
+
+void mo5_shadow_flush(MO5_Shadow *sh)
+{
+    *PRC &= ~0x01;
+    shadow_copy(sh, sh->color);
+
+    *PRC |= 0x01;
+    shadow_copy(sh, sh->form);
+
+    shadow_reset(sh);
+}
@@ -0,0 +1,23 @@
+/**
+ * @file
+ * @brief Sprite sheets — implémentation.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_sheet.h"
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_sheet_frame(const MO5_SpriteSheet *sheet, unsigned char index, MO5_Sprite *out)
+{
+    const MO5_SheetFrame *f = &sheet->frames[index];
+
+    out->form        = sheet->data + f->form;
+    out->color       = sheet->data + f->color;
+    out->width_bytes = sheet->width_bytes;
+    out->height      = sheet->height;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file
+ * @brief Buzzer sound — implémentation.
+ *
+ * Une rafale = demi-périodes de la note jouées à la suite :
+ *
+ *   EORA #1 / STA $A7C1        bascule du buzzer          7 cycles
+ *   LDY period                 recharge du délai          7
+ *   LEAY -1,Y / BNE            délai                      8 par unité
+ *   LEAX -1,X / BNE            demi-période suivante      8
+ *
+ * soit 22 + 8 x period cycles par demi-période (MO5_SOUND_HALF_BASE et
+ * MO5_SOUND_HALF_STEP, repris par scripts/mo5tune.py). Le nombre de
+ * demi-périodes d'une rafale est calculé une fois par note, au
+ * chargement : la routine du tick ne fait ensuite que la boucle.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include <cmoc.h>
+#include "mo5_sound.h"
+#include "mo5_tick.h"
+
+// ============================================================================
+// ÉTAT INTERNE
+// ============================================================================
+
+typedef struct {
+    const MO5_Note *start;      // début de la table (reprise en boucle)
+    const MO5_Note *note;       // note courante
+    unsigned int    halves;     // demi-périodes par tick (0 : silence)
+    unsigned char   left;       // ticks restants de la note courante
+    unsigned char   loop;
+    unsigned char   active;
+} SoundChannel;
+
+static SoundChannel  snd_music;
+static SoundChannel  snd_sfx;
+static unsigned int  snd_burst = MO5_SOUND_BURST;
+static unsigned char snd_installed;
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/* Demi-périodes de `period` tenant dans une rafale. */
+static unsigned int sound_halves(unsigned int period)
+{
+    if (period == MO5_NOTE_REST || period > MO5_SOUND_MAX_PERIOD)
+        return 0;
+    return snd_burst / (MO5_SOUND_HALF_BASE + MO5_SOUND_HALF_STEP * period);
+}
+
+/* Charge la note courante ; en fin de table, reboucle ou arrête le canal. */
+static void sound_load(SoundChannel *ch)
+{
+    if (ch->note->ticks == 0) {
+        if (!ch->loop || ch->note == ch->start) {   /* table vide : pas de boucle infinie */
+            ch->active = 0;
+            return;
+        }
+        ch->note = ch->start;
+    }
+    ch->left   = ch->note->ticks;
+    ch->halves = sound_halves(ch->note->period);
+}
+
+/* Appelable IRQ masquées (routine de tick, section critique) : CC est restauré tel quel. */
+static void sound_start(SoundChannel *ch, const MO5_Note *notes, unsigned char loop)
+{
+    unsigned char saved_cc;
+
+    asm {
+        tfr     cc,a
+        sta     saved_cc
+        orcc    #$10
+    }
+    ch->start  = notes;
+    ch->note   = notes;
+    ch->loop   = loop;
+    ch->active = 1;
+    sound_load(ch);
+    asm {
+        lda     saved_cc
+        tfr     a,cc
+    }
+}
+
+/* Avance d'un tick. */
+static void sound_step(SoundChannel *ch)
+{
+    if (!ch->active)
+        return;
+    if (--ch->left == 0) {
+        ch->note++;
+        sound_load(ch);
+    }
+}
+
+/* Joue `halves` demi-périodes de `period` sur le buzzer (IRQ masquées). */
+static void sound_burst(unsigned int period, unsigned int halves)
+{
+    asm {
+        pshs    y
+        ldx     halves
+        lda     $A7C1
+snd_half:
+        eora    #$01
+        sta     $A7C1
+        ldy     period
+snd_delay:
+        leay    -1,y
+        bne     snd_delay
+        leax    -1,x
+        bne     snd_half
+        puls    y
+    }
+}
+
+/* Routine du tick : une rafale de l'effet, ou à défaut de la musique. */
+static void sound_tick(void)
+{
+    SoundChannel *ch = NULL;
+
+    if (snd_sfx.active)
+        ch = &snd_sfx;
+    else if (snd_music.active)
+        ch = &snd_music;
+
+    if (ch && ch->halves)
+        sound_burst(ch->note->period, ch->halves);
+
+    sound_step(&snd_music);
+    sound_step(&snd_sfx);
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+unsigned char mo5_sound_init(void)
+{
+    if (snd_installed)
+        return 1;
+
+    mo5_tick_init();
+    if (mo5_tick_add(sound_tick) == MO5_TICK_FULL) {
+        mo5_tick_shutdown();
+        return 0;
+    }
+    snd_installed = 1;
+    return 1;
+}
+
+void mo5_sound_shutdown(void)
+{
+    if (!snd_installed)
+        return;
+
+    mo5_tick_remove(sound_tick);
+    mo5_tick_shutdown();
+    snd_music.active = 0;
+    snd_sfx.active   = 0;
+    *MO5_SOUND_PORT &= ~MO5_SOUND_BIT;
+    snd_installed = 0;
+}
+
+void mo5_sound_music(const MO5_Note *song, unsigned char loop)
+{
+    sound_start(&snd_music, song, loop);
+}
+
+void mo5_sound_stop_music(void)
+{
+    snd_music.active = 0;
+}
+
+void mo5_sound_sfx(const MO5_Note *sfx)
+{
+    sound_start(&snd_sfx, sfx, 0);
+}
+
+void mo5_sound_stop(void)
+{
+    snd_music.active = 0;
+    snd_sfx.active   = 0;
+}
+
+unsigned char mo5_sound_playing(void)
+{
+    unsigned char flags = 0;
+
+    if (snd_music.active) flags |= MO5_SOUND_MUSIC;
+    if (snd_sfx.active)   flags |= MO5_SOUND_SFX;
+    return flags;
+}
+
+void mo5_sound_set_burst(unsigned int cycles)
+{
+    snd_burst = cycles;
+}
@@ -20,7 +20,7 @@ static void fill_rect_vram(unsigned char tx,          unsigned char ty,
                            unsigned char width_bytes, unsigned char height,
                            unsigned char value)
 {
-    unsigned char *row      = VRAM + (unsigned int)ty * SCREEN_WIDTH_BYTES + tx;
+    unsigned char *row      = VRAM_ADDR(tx, ty);
     unsigned char  rows_left = height;
 
     while (rows_left--) {
@@ -40,7 +40,7 @@ static void blit_rect_vram(unsigned char tx,          unsigned char ty,
                            unsigned char width_bytes, unsigned char height,
                            unsigned char *src)
 {
-    unsigned char *row      = VRAM + (unsigned int)ty * SCREEN_WIDTH_BYTES + tx;
+    unsigned char *row      = VRAM_ADDR(tx, ty);
     unsigned char  rows_left = height;
 
     while (rows_left--) {
@@ -51,35 +51,55 @@ static void blit_rect_vram(unsigned char tx,          unsigned char ty,
     }
 }
 
-// ============================================================================
-// API BAS NIVEAU
-// ============================================================================
-
-void mo5_draw_sprite(unsigned char tx,          unsigned char ty,
-                     unsigned char *form_data,  unsigned char *color_data,
-                     unsigned char width_bytes, unsigned char height)
+/*
+ * Variante miroir de blit_rect_vram. reverse_bits : banque forme (les
+ * octets sont aussi inversés bit à bit pour un miroir horizontal).
+ * PRC doit être positionné avant l'appel.
+ */
+static void blit_rect_vram_flip(unsigned char tx,          unsigned char ty,
+                                unsigned char width_bytes, unsigned char height,
+                                unsigned char *src,        unsigned char flip,
+                                unsigned char reverse_bits)
 {
-    *PRC &= ~0x01;
-    blit_rect_vram(tx, ty, width_bytes, height, color_data);
+    unsigned char *row      = VRAM_ADDR(tx, ty);
+    unsigned char  rows_left = height;
+    int            src_step = width_bytes;
+    unsigned char *p;
+    unsigned char *s;
+    unsigned char  col;
 
-    *PRC |= 0x01;
-    blit_rect_vram(tx, ty, width_bytes, height, form_data);
-}
+    /* Miroir vertical : lecture des lignes de bas en haut */
+    if (flip & MO5_FLIP_V) {
+        src      += (unsigned int)(height - 1) * width_bytes;
+        src_step  = -src_step;
+    }
 
-void mo5_clear_sprite(unsigned char tx,          unsigned char ty,
-                      unsigned char width_bytes, unsigned char height)
-{
-    *PRC &= ~0x01;
-    fill_rect_vram(tx, ty, width_bytes, height, 0x00);
+    while (rows_left--) {
+        p   = row;
+        col = width_bytes;
 
-    *PRC |= 0x01;
-    fill_rect_vram(tx, ty, width_bytes, height, 0x00);
+        if (!(flip & MO5_FLIP_H)) {
+            s = src;
+            while (col--) *p++ = *s++;
+        } else if (reverse_bits) {
+            s = src + width_bytes;
+            while (col--) *p++ = mo5_flip_lut[*--s];
+        } else {
+            s = src + width_bytes;
+            while (col--) *p++ = *--s;
+        }
+
+        row += SCREEN_WIDTH_BYTES;
+        src += src_step;
+    }
 }
 
-void mo5_move_sprite(unsigned char old_tx,      unsigned char old_ty,
-                     unsigned char new_tx,       unsigned char new_ty,
-                     unsigned char *form_data,   unsigned char *color_data,
-                     unsigned char width_bytes,  unsigned char height)
+/* Move différentiel commun à mo5_move_sprite et mo5_move_sprite_flip. */
+static void sprite_move(unsigned char old_tx,      unsigned char old_ty,
+                        unsigned char new_tx,       unsigned char new_ty,
+                        unsigned char *form_data,   unsigned char *color_data,
+                        unsigned char width_bytes,  unsigned char height,
+                        unsigned char flip)
 {
     signed char   dx   = (signed char)(new_tx - old_tx);
     signed char   dy   = (signed char)(new_ty - old_ty);
@@ -88,8 +108,8 @@ void mo5_move_sprite(unsigned char old_tx,      unsigned char old_ty,
     unsigned char bank;
 
     if (adx >= width_bytes || ady >= height) {
-        mo5_clear_sprite(old_tx, old_ty, width_bytes, height);
-        mo5_draw_sprite (new_tx, new_ty, form_data, color_data, width_bytes, height);
+        mo5_clear_sprite    (old_tx, old_ty, width_bytes, height);
+        mo5_draw_sprite_flip(new_tx, new_ty, form_data, color_data, width_bytes, height, flip);
         return;
     }
 
@@ -113,10 +133,69 @@ void mo5_move_sprite(unsigned char old_tx,      unsigned char old_ty,
             fill_rect_vram(old_tx, clear_y, width_bytes, ady, 0x00);
         }
 
-        blit_rect_vram(new_tx, new_ty, width_bytes, height, src);
+        if (flip)
+            blit_rect_vram_flip(new_tx, new_ty, width_bytes, height, src, flip, bank);
+        else
+            blit_rect_vram(new_tx, new_ty, width_bytes, height, src);
     }
 }
 
+// ============================================================================
+// API BAS NIVEAU
+// ============================================================================
+
+void mo5_draw_sprite(unsigned char tx,          unsigned char ty,
+                     unsigned char *form_data,  unsigned char *color_data,
+                     unsigned char width_bytes, unsigned char height)
+{
+    *PRC &= ~0x01;
+    blit_rect_vram(tx, ty, width_bytes, height, color_data);
+
+    *PRC |= 0x01;
+    blit_rect_vram(tx, ty, width_bytes, height, form_data);
+}
+
+void mo5_clear_sprite(unsigned char tx,          unsigned char ty,
+                      unsigned char width_bytes, unsigned char height)
+{
+    *PRC &= ~0x01;
+    fill_rect_vram(tx, ty, width_bytes, height, 0x00);
+
+    *PRC |= 0x01;
+    fill_rect_vram(tx, ty, width_bytes, height, 0x00);
+}
+
+void mo5_move_sprite(unsigned char old_tx,      unsigned char old_ty,
+                     unsigned char new_tx,       unsigned char new_ty,
+                     unsigned char *form_data,   unsigned char *color_data,
+                     unsigned char width_bytes,  unsigned char height)
+{
+    sprite_move(old_tx, old_ty, new_tx, new_ty,
+                form_data, color_data, width_bytes, height, MO5_FLIP_NONE);
+}
+
+void mo5_draw_sprite_flip(unsigned char tx,          unsigned char ty,
+                          unsigned char *form_data,  unsigned char *color_data,
+                          unsigned char width_bytes, unsigned char height,
+                          unsigned char flip)
+{
+    *PRC &= ~0x01;
+    blit_rect_vram_flip(tx, ty, width_bytes, height, color_data, flip, 0);
+
+    *PRC |= 0x01;
+    blit_rect_vram_flip(tx, ty, width_bytes, height, form_data, flip, 1);
+}
+
+void mo5_move_sprite_flip(unsigned char old_tx,      unsigned char old_ty,
+                          unsigned char new_tx,       unsigned char new_ty,
+                          unsigned char *form_data,   unsigned char *color_data,
+                          unsigned char width_bytes,  unsigned char height,
+                          unsigned char flip)
+{
+    sprite_move(old_tx, old_ty, new_tx, new_ty,
+                form_data, color_data, width_bytes, height, flip);
+}
+
 // ============================================================================
 // API ACTOR
 // ============================================================================
@@ -155,6 +234,33 @@ void mo5_actor_move(MO5_Actor *actor, unsigned char new_x, unsigned char new_y)
     );
 }
 
+void mo5_actor_draw_flip(const MO5_Actor *actor, unsigned char flip)
+{
+    mo5_draw_sprite_flip(
+        actor->pos.x,               actor->pos.y,
+        actor->sprite->form,        actor->sprite->color,
+        actor->sprite->width_bytes, actor->sprite->height,
+        flip
+    );
+}
+
+void mo5_actor_move_flip(MO5_Actor *actor, unsigned char new_x, unsigned char new_y,
+                         unsigned char flip)
+{
+    actor->old_pos = actor->pos;
+    actor->pos.x   = new_x;
+    actor->pos.y   = new_y;
+
+    /* Position inchangée : le blit opaque écrase l'ancienne orientation */
+    mo5_move_sprite_flip(
+        actor->old_pos.x,           actor->old_pos.y,
+        actor->pos.x,               actor->pos.y,
+        actor->sprite->form,        actor->sprite->color,
+        actor->sprite->width_bytes, actor->sprite->height,
+        flip
+    );
+}
+
 void mo5_actor_clamp(MO5_Actor *actor)
 {
     unsigned char max_x = SCREEN_WIDTH_BYTES - actor->sprite->width_bytes;
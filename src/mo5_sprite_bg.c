@@ -7,6 +7,11 @@
  *           si fg != 0 → (VRAM & 0x0F) | fg  sur banque couleur
  *                        VRAM |= form          sur banque forme
  *   Clear : forme = 0x00 (passe unique — banque couleur non touchée)
+ *   Move  : clear des seules bandes découvertes ; dans la zone commune aux
+ *           deux positions, la forme est remplacée (= au lieu de |=), ce
+ *           qui efface l'ancien sprite sans passe de clear.
+ *   Flip  : même draw, source lue de droite à gauche (forme inversée bit à
+ *           bit par mo5_flip_lut) et/ou de bas en haut.
  *
  * SPDX-License-Identifier: MIT
  * Copyright (c) 2026 Thierry Le Got
@@ -14,6 +19,86 @@
 
  #include "mo5_sprite_bg.h"
 
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/* Draw d'un segment de ligne en mode remplacement : forme = form si fg != 0,
+   0x00 sinon — équivaut à clear + draw sur un octet de l'ancien sprite. */
+static void bg_span_replace(unsigned char *p,
+                            unsigned char *form_src, unsigned char *color_src,
+                            unsigned char n)
+{
+    unsigned char fg;
+
+    while (n--) {
+        fg = *color_src & 0xF0;
+
+        if (fg) {
+            *PRC &= ~0x01;
+            *p = (*p & 0x0F) | fg;
+
+            *PRC |= 0x01;
+            *p = *form_src;
+        } else {
+            *PRC |= 0x01;
+            *p = 0x00;
+        }
+
+        p++;
+        color_src++;
+        form_src++;
+    }
+}
+
+/* Draw d'un segment de ligne en mode normal (|=), comme mo5_draw_sprite_bg. */
+static void bg_span_or(unsigned char *p,
+                       unsigned char *form_src, unsigned char *color_src,
+                       unsigned char n)
+{
+    unsigned char fg;
+
+    while (n--) {
+        fg = *color_src & 0xF0;
+
+        if (fg) {
+            *PRC &= ~0x01;
+            *p = (*p & 0x0F) | fg;
+
+            *PRC |= 0x01;
+            *p |= *form_src;
+        }
+
+        p++;
+        color_src++;
+        form_src++;
+    }
+}
+
+/* Draw d'une ligne lue de droite à gauche (miroir horizontal) : form_end
+   et color_end pointent juste après la fin de la ligne source. */
+static void bg_row_mirror(unsigned char *p,
+                          unsigned char *form_end, unsigned char *color_end,
+                          unsigned char n)
+{
+    unsigned char fg;
+
+    while (n--) {
+        fg = *--color_end & 0xF0;
+        --form_end;
+
+        if (fg) {
+            *PRC &= ~0x01;
+            *p = (*p & 0x0F) | fg;
+
+            *PRC |= 0x01;
+            *p |= mo5_flip_lut[*form_end];
+        }
+
+        p++;
+    }
+}
+
 // ============================================================================
 // API BAS NIVEAU
 // ============================================================================
@@ -22,7 +107,7 @@ void mo5_draw_sprite_bg(unsigned char tx,          unsigned char ty,
                         unsigned char *form_src,   unsigned char *color_src,
                         unsigned char width_bytes, unsigned char height)
 {
-    unsigned char *row = VRAM + (unsigned int)ty * SCREEN_WIDTH_BYTES + tx;
+    unsigned char *row = VRAM_ADDR(tx, ty);
     unsigned char  rows_left = height;
     unsigned char  fg;
 
@@ -53,7 +138,7 @@ void mo5_draw_sprite_bg(unsigned char tx,          unsigned char ty,
 void mo5_clear_sprite_bg(unsigned char tx,          unsigned char ty,
                          unsigned char width_bytes, unsigned char height)
 {
-    unsigned char *row      = VRAM + (unsigned int)ty * SCREEN_WIDTH_BYTES + tx;
+    unsigned char *row      = VRAM_ADDR(tx, ty);
     unsigned char  rows_left = height;
 
     *PRC |= 0x01;
@@ -72,8 +157,84 @@ void mo5_move_sprite_bg(unsigned char old_tx,      unsigned char old_ty,
                         unsigned char *form_src,   unsigned char *color_src,
                         unsigned char width_bytes, unsigned char height)
 {
-    mo5_clear_sprite_bg(old_tx, old_ty, width_bytes, height);
-    mo5_draw_sprite_bg (new_tx, new_ty, form_src, color_src, width_bytes, height);
+    signed char    dx  = (signed char)(new_tx - old_tx);
+    signed char    dy  = (signed char)(new_ty - old_ty);
+    unsigned char  adx = dx < 0 ? -dx : dx;
+    unsigned char  ady = dy < 0 ? -dy : dy;
+    unsigned char *row;
+    unsigned char  y;
+    unsigned char  y0, y1;       // lignes communes, relatives au nouveau sprite
+    unsigned char  x0, x1;       // colonnes communes, idem
+
+    if (adx >= width_bytes || ady >= height) {
+        mo5_clear_sprite_bg(old_tx, old_ty, width_bytes, height);
+        mo5_draw_sprite_bg (new_tx, new_ty, form_src, color_src, width_bytes, height);
+        return;
+    }
+
+    /* Clear colonne sortante */
+    if (dx != 0) {
+        unsigned char clear_x = (dx > 0) ? old_tx
+                                          : old_tx + width_bytes - adx;
+        mo5_clear_sprite_bg(clear_x, old_ty, adx, height);
+    }
+
+    /* Clear ligne sortante */
+    if (dy != 0) {
+        unsigned char clear_y = (dy > 0) ? old_ty
+                                          : old_ty + height - ady;
+        mo5_clear_sprite_bg(old_tx, clear_y, width_bytes, ady);
+    }
+
+    /* Zone commune aux deux positions */
+    y0 = (dy < 0) ? ady : 0;
+    y1 = y0 + height - ady;
+    x0 = (dx < 0) ? adx : 0;
+    x1 = x0 + width_bytes - adx;
+
+    row = VRAM_ADDR(new_tx, new_ty);
+    for (y = 0; y < height; y++) {
+        if (y < y0 || y >= y1) {
+            bg_span_or(row, form_src, color_src, width_bytes);
+        } else {
+            bg_span_or     (row,      form_src,      color_src,      x0);
+            bg_span_replace(row + x0, form_src + x0, color_src + x0, x1 - x0);
+            bg_span_or     (row + x1, form_src + x1, color_src + x1, width_bytes - x1);
+        }
+
+        row       += SCREEN_WIDTH_BYTES;
+        form_src  += width_bytes;
+        color_src += width_bytes;
+    }
+}
+
+void mo5_draw_sprite_bg_flip(unsigned char tx,          unsigned char ty,
+                             unsigned char *form_src,   unsigned char *color_src,
+                             unsigned char width_bytes, unsigned char height,
+                             unsigned char flip)
+{
+    unsigned char *row       = VRAM_ADDR(tx, ty);
+    unsigned char  rows_left = height;
+    int            src_step  = width_bytes;
+
+    /* Miroir vertical : lecture des lignes de bas en haut */
+    if (flip & MO5_FLIP_V) {
+        unsigned int last = (unsigned int)(height - 1) * width_bytes;
+        form_src  += last;
+        color_src += last;
+        src_step   = -src_step;
+    }
+
+    while (rows_left--) {
+        if (flip & MO5_FLIP_H)
+            bg_row_mirror(row, form_src + width_bytes, color_src + width_bytes, width_bytes);
+        else
+            bg_span_or(row, form_src, color_src, width_bytes);
+
+        row       += SCREEN_WIDTH_BYTES;
+        form_src  += src_step;
+        color_src += src_step;
+    }
 }
 
 // ============================================================================
@@ -112,4 +273,29 @@ void mo5_actor_move_bg(MO5_Actor *actor, unsigned char new_x, unsigned char new_
         actor->sprite->form,        actor->sprite->color,
         actor->sprite->width_bytes, actor->sprite->height
     );
+}
+
+void mo5_actor_draw_bg_flip(const MO5_Actor *actor, unsigned char flip)
+{
+    mo5_draw_sprite_bg_flip(
+        actor->pos.x,               actor->pos.y,
+        actor->sprite->form,        actor->sprite->color,
+        actor->sprite->width_bytes, actor->sprite->height,
+        flip
+    );
+}
+
+void mo5_actor_move_bg_flip(MO5_Actor *actor, unsigned char new_x, unsigned char new_y,
+                            unsigned char flip)
+{
+    actor->old_pos = actor->pos;
+    actor->pos.x   = new_x;
+    actor->pos.y   = new_y;
+
+    /* Clear complet : l'orientation a pu changer, la zone commune aussi */
+    mo5_clear_sprite_bg(
+        actor->old_pos.x,           actor->old_pos.y,
+        actor->sprite->width_bytes, actor->sprite->height
+    );
+    mo5_actor_draw_bg_flip(actor, flip);
 }
\ No newline at end of file
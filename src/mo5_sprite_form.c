@@ -7,6 +7,8 @@
  *
  * Draw  form  : = form_data  (single pass, direct write)
  * Clear form  : = 0x00       (single pass)
+ * Move        : clear des seules bandes découvertes, puis draw (l'écriture
+ *               directe écrase l'ancien sprite dans la zone de recouvrement)
  *
  * SPDX-License-Identifier: MIT
  * Copyright (c) 2026 Thierry Le Got
@@ -22,7 +24,7 @@ void mo5_draw_sprite_form(unsigned char tx,          unsigned char ty,
                           unsigned char *form_data,
                           unsigned char width_bytes, unsigned char height)
 {
-    unsigned char *row      = VRAM + (unsigned int)ty * SCREEN_WIDTH_BYTES + tx;
+    unsigned char *row      = VRAM_ADDR(tx, ty);
     unsigned char  rows_left = height;
 
     *PRC |= 0x01;
@@ -37,7 +39,7 @@ void mo5_draw_sprite_form(unsigned char tx,          unsigned char ty,
 void mo5_clear_sprite_form(unsigned char tx,          unsigned char ty,
                            unsigned char width_bytes, unsigned char height)
 {
-    unsigned char *row      = VRAM + (unsigned int)ty * SCREEN_WIDTH_BYTES + tx;
+    unsigned char *row      = VRAM_ADDR(tx, ty);
     unsigned char  rows_left = height;
 
     *PRC |= 0x01;
@@ -54,8 +56,32 @@ void mo5_move_sprite_form(unsigned char old_tx,      unsigned char old_ty,
                           unsigned char *form_data,
                           unsigned char width_bytes, unsigned char height)
 {
-    mo5_clear_sprite_form(old_tx, old_ty, width_bytes, height);
-    mo5_draw_sprite_form (new_tx, new_ty, form_data, width_bytes, height);
+    signed char   dx  = (signed char)(new_tx - old_tx);
+    signed char   dy  = (signed char)(new_ty - old_ty);
+    unsigned char adx = dx < 0 ? -dx : dx;
+    unsigned char ady = dy < 0 ? -dy : dy;
+
+    if (adx >= width_bytes || ady >= height) {
+        mo5_clear_sprite_form(old_tx, old_ty, width_bytes, height);
+        mo5_draw_sprite_form (new_tx, new_ty, form_data, width_bytes, height);
+        return;
+    }
+
+    /* Clear colonne sortante */
+    if (dx != 0) {
+        unsigned char clear_x = (dx > 0) ? old_tx
+                                          : old_tx + width_bytes - adx;
+        mo5_clear_sprite_form(clear_x, old_ty, adx, height);
+    }
+
+    /* Clear ligne sortante */
+    if (dy != 0) {
+        unsigned char clear_y = (dy > 0) ? old_ty
+                                          : old_ty + height - ady;
+        mo5_clear_sprite_form(old_tx, clear_y, width_bytes, ady);
+    }
+
+    mo5_draw_sprite_form(new_tx, new_ty, form_data, width_bytes, height);
 }
 
 // ============================================================================
@@ -0,0 +1,113 @@
+/**
+ * @file
+ * @brief Fast string and memory routines — implémentation.
+ *
+ * CMOC utilise U comme pointeur de cadre : toutes les variables C sont
+ * chargées dans des registres avant que U ne soit détourné, puis U (et Y)
+ * sont restaurés en fin de bloc asm.
+ *
+ * memcpy / memset traitent d'abord les blocs entiers de 4 / 8 octets en
+ * assembleur, puis le reste (< 4 / < 8 octets) en C.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_string.h"
+
+unsigned int mo5_strlen(const char *str)
+{
+    unsigned int len;
+
+    asm {
+        ldx     str
+mo5_strlen_loop:
+        lda     ,x+
+        bne     mo5_strlen_loop
+        tfr     x,d
+        subd    str
+        subd    #1              /* X pointe après le terminateur */
+        std     len
+    }
+
+    return len;
+}
+
+char *mo5_strcpy(char *dst, const char *src)
+{
+    asm {
+        pshs    y
+        ldx     src
+        ldy     dst
+mo5_strcpy_loop:
+        lda     ,x+
+        sta     ,y+             /* STA positionne Z : arrêt après le 0 */
+        bne     mo5_strcpy_loop
+        puls    y
+    }
+
+    return dst;
+}
+
+void *mo5_memcpy(void *dst, const void *src, unsigned int n)
+{
+    unsigned char       *to   = (unsigned char *)dst;
+    const unsigned char *from = (const unsigned char *)src;
+    unsigned char       *stop = to + (n & ~3u);     /* fin des blocs de 4 */
+    unsigned char        rest = (unsigned char)n & 3;
+
+    if (to != stop) {
+        asm {
+            pshs    u,y
+            ldy     to
+            ldx     stop
+            ldu     from            /* dernier accès aux variables C */
+            pshs    x
+mo5_memcpy_loop:
+            pulu    d,x             /* 4 octets source, U += 4 */
+            std     ,y++
+            stx     ,y++
+            cmpy    ,s
+            bne     mo5_memcpy_loop
+            leas    2,s
+            puls    u,y
+        }
+        from += n & ~3u;
+        to    = stop;
+    }
+
+    while (rest--) *to++ = *from++;
+
+    return dst;
+}
+
+void *mo5_memset(void *dst, unsigned char value, unsigned int n)
+{
+    unsigned char *to     = (unsigned char *)dst;
+    unsigned char *last   = to + n;
+    unsigned int   blocks = n >> 3;
+    unsigned char  rest   = (unsigned char)n & 7;
+
+    /* PSHU écrit vers le bas : les blocs remplissent la fin du tampon,
+       le reste (début du tampon) est fait en C. */
+    if (blocks) {
+        asm {
+            pshs    u,y
+            ldy     blocks
+            lda     value
+            tfr     a,b
+            tfr     d,x
+            ldu     last            /* dernier accès aux variables C */
+mo5_memset_loop:
+            pshu    d,x
+            pshu    d,x
+            leay    -1,y
+            bne     mo5_memset_loop
+            puls    u,y
+        }
+    }
+
+    while (rest--) *to++ = value;
+
+    return dst;
+}
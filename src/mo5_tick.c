@@ -0,0 +1,146 @@
+/**
+ * @file
+ * @brief 50 Hz tick — implémentation.
+ *
+ * Attente sans race : l'IRQ est masquée pendant la comparaison du
+ * compteur, puis CWAI #$EF la démasque et suspend le CPU en une seule
+ * instruction. Une IRQ arrivée entre le test et l'attente reste en
+ * suspens et réveille CWAI immédiatement.
+ *
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Thierry Le Got
+ */
+
+#include "mo5_tick.h"
+#include "mo5_video.h"
+
+volatile unsigned int mo5_tick_count;
+unsigned int          mo5_tick_dropped;
+
+// ============================================================================
+// ÉTAT INTERNE
+// ============================================================================
+
+static void         (*tick_hooks[MO5_TICK_MAX_HOOKS])(void);
+static unsigned int   tick_seen;          // mo5_tick_count au dernier wait
+static unsigned char  tick_users;         // mo5_tick_init non encore libérés
+
+static void         (*tick_old_timept)(void);
+static unsigned char  tick_old_status;
+
+// ============================================================================
+// HELPERS INTERNES
+// ============================================================================
+
+/* Appelée par le moniteur à chaque IRQ 50 Hz (STATUS bit 5). */
+static void tick_timer(void)
+{
+    unsigned char i;
+
+    mo5_tick_count++;
+
+    for (i = 0; i < MO5_TICK_MAX_HOOKS; i++)
+        if (tick_hooks[i])
+            tick_hooks[i]();
+}
+
+// ============================================================================
+// API PUBLIQUE
+// ============================================================================
+
+void mo5_tick_init(void)
+{
+    unsigned char saved_cc;
+
+    if (tick_users++)
+        return;
+
+    asm {                           /* IRQ masquées pendant le changement */
+        tfr     cc,a
+        sta     saved_cc
+        orcc    #$10
+    }
+    tick_old_timept = *MON_TIMEPT;
+    tick_old_status = *MON_STATUS;
+    *MON_TIMEPT     = tick_timer;
+    *MON_STATUS    |= MON_TIMER_BIT;
+    tick_seen       = mo5_tick_count;
+    asm {                           /* CC de l'appelant : IRQ masquées s'il l'étaient */
+        lda     saved_cc
+        tfr     a,cc
+    }
+}
+
+void mo5_tick_shutdown(void)
+{
+    unsigned char saved_cc;
+
+    if (tick_users == 0 || --tick_users)
+        return;
+
+    asm {
+        tfr     cc,a
+        sta     saved_cc
+        orcc    #$10
+    }
+    *MON_TIMEPT = tick_old_timept;
+    *MON_STATUS = (*MON_STATUS & ~MON_TIMER_BIT) | (tick_old_status & MON_TIMER_BIT);
+    asm {
+        lda     saved_cc
+        tfr     a,cc
+    }
+}
+
+unsigned char mo5_tick_add(void (*fn)(void))
+{
+    unsigned char i;
+
+    for (i = 0; i < MO5_TICK_MAX_HOOKS; i++) {
+        if (tick_hooks[i] == 0) {
+            tick_hooks[i] = fn;     /* écriture 16 bits : atomique pour l'IRQ */
+            return i;
+        }
+    }
+    return MO5_TICK_FULL;
+}
+
+void mo5_tick_remove(void (*fn)(void))
+{
+    unsigned char i;
+
+    for (i = 0; i < MO5_TICK_MAX_HOOKS; i++)
+        if (tick_hooks[i] == fn)
+            tick_hooks[i] = 0;
+}
+
+unsigned char mo5_tick_wait(void)
+{
+    unsigned int  elapsed;
+    unsigned char saved_cc;
+
+    /* Sans routine installée le compteur ne bouge pas : attente du VBL */
+    if (tick_users == 0) {
+        mo5_wait_vbl();
+        return 1;
+    }
+
+    asm {
+        tfr     cc,a
+        sta     saved_cc
+        orcc    #$10
+    }
+    while (mo5_tick_count == tick_seen) {
+        asm { cwai #$EF }           /* démasque l'IRQ et dort jusqu'à elle */
+        asm { orcc #$10 }
+    }
+    elapsed   = mo5_tick_count - tick_seen;
+    tick_seen = mo5_tick_count;
+    asm {                           /* CC d'entrée, après le démasquage de CWAI */
+        lda     saved_cc
+        tfr     a,cc
+    }
+
+    mo5_tick_dropped += elapsed - 1;
+
+    return elapsed > 255 ? 255 : (unsigned char)elapsed;
+}
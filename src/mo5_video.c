@@ -7,11 +7,23 @@
  */
 
 #include "mo5_video.h"
+#include "mo5_frame.h"
+
+/* Offset VRAM de chaque ligne : row_offsets[y] = y * 40 */
+unsigned int row_offsets[SCREEN_HEIGHT];
 
 void mo5_video_init(unsigned char color)
 {
     unsigned char *p;
     unsigned int   n;
+    unsigned char  y;
+
+    /* Additions successives : aucune multiplication, même ici */
+    n = 0;
+    for (y = 0; y < SCREEN_HEIGHT; y++) {
+        row_offsets[y] = n;
+        n += SCREEN_WIDTH_BYTES;
+    }
 
     *PRC    = 0x00;
     *VIDEO_REG |= 0x01;
@@ -31,8 +43,21 @@ void mo5_video_init(unsigned char color)
 
 void mo5_wait_vbl(void)
 {
-    while ( *VBL_REG &  VBL_BIT) ;
-    while (!(*VBL_REG & VBL_BIT)) ;
+    unsigned int spins;
+
+    mo5_frame_wait_begin();
+
+    /* Chaque itération = temps CPU inutilisé par la frame */
+    spins = 0;
+    while ( *VBL_REG &  VBL_BIT) spins++;
+    while (!(*VBL_REG & VBL_BIT)) spins++;
+
+    mo5_frame_wait_end(spins);
+}
+
+void mo5_set_border(unsigned char color)
+{
+    *PRC = (*PRC & ~BORDER_MASK) | ((color & 0x0F) << 1);
 }
 
 void mo5_clear_screen(unsigned char color)
@@ -61,7 +86,7 @@ void mo5_fill_rect(unsigned char tx, unsigned char ty,
     unsigned char  rows_left = h;
 
     *PRC &= ~0x01;
-    row = VRAM + (unsigned int)ty * SCREEN_WIDTH_BYTES + tx;
+    row = VRAM_ADDR(tx, ty);
     while (rows_left--) {
         p = row;
         j = w;
@@ -70,7 +95,7 @@ void mo5_fill_rect(unsigned char tx, unsigned char ty,
     }
 
     *PRC |= 0x01;
-    row = VRAM + (unsigned int)ty * SCREEN_WIDTH_BYTES + tx;
+    row = VRAM_ADDR(tx, ty);
     rows_left = h;
     while (rows_left--) {
         p = row;